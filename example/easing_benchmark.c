@@ -0,0 +1,131 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This example file compares evaluating easings directly and from tables.
+///
+/// This project is licensed under the terms of MIT license.
+
+#include <stdio.h>
+#include <time.h>
+
+#include "crystalgui/crystalgui.h"
+#include "raylib.h"
+
+// Number of easing evaluations per measurement
+#define EVALUATIONS_COUNT (1 << 22)
+
+// Number of samples in each table
+#define SAMPLES_COUNT 256
+
+typedef struct ElasticParams {
+    float amplitude;
+    float period;
+    float base;
+    float power;
+} ElasticParams;
+
+float SampleElasticPro(float t, void *userData)
+{
+    ElasticParams *params = userData;
+    return CguiEaseInOutElasticPro(t, params->amplitude, params->period, params->base, params->power);
+}
+
+ElasticParams elasticParams = { 1.2f, 0.4f, 2.0f, 10.0f };
+
+float EaseElasticPro(float t)
+{
+    return SampleElasticPro(t, &elasticParams);
+}
+
+typedef struct Benchmark {
+    const char        *name;
+    CguiEasingFunction easing;
+} Benchmark;
+
+// Prevent the evaluations from being optimized away
+volatile float sink = 0.0f;
+
+double MeasureDirect(CguiEasingFunction easing)
+{
+    float   sum   = 0.0f;
+    clock_t start = clock();
+
+    for (int i = 0; i < EVALUATIONS_COUNT; i++)
+    {
+        sum += easing((float) i / EVALUATIONS_COUNT);
+    }
+
+    clock_t end = clock();
+    sink        = sum;
+
+    return (double) (end - start) / CLOCKS_PER_SEC;
+}
+
+double MeasureTable(const CguiEasingTable *table)
+{
+    float   sum   = 0.0f;
+    clock_t start = clock();
+
+    for (int i = 0; i < EVALUATIONS_COUNT; i++)
+    {
+        sum += CguiEvalEasingTable(table, (float) i / EVALUATIONS_COUNT);
+    }
+
+    clock_t end = clock();
+    sink        = sum;
+
+    return (double) (end - start) / CLOCKS_PER_SEC;
+}
+
+int main()
+{
+    Benchmark benchmarks[] = {
+        { "InOutQuad",       CguiEaseInOutQuad    },
+        { "InOutNonic",      CguiEaseInOutNonic   },
+        { "InOutSine",       CguiEaseInOutSine    },
+        { "InOutExpo",       CguiEaseInOutExpo    },
+        { "InOutCirc",       CguiEaseInOutCirc    },
+        { "InOutBack",       CguiEaseInOutBack    },
+        { "InOutElastic",    CguiEaseInOutElastic },
+        { "InOutBounce",     CguiEaseInOutBounce  },
+        { "InOutElasticPro", EaseElasticPro       },
+    };
+    int benchmarksCount = sizeof(benchmarks) / sizeof(benchmarks[0]);
+
+    printf("%d evaluations, %d samples per table\n\n", EVALUATIONS_COUNT, SAMPLES_COUNT);
+    printf("%-16s %12s %12s %8s %12s\n", "Easing", "Direct (ns)", "Table (ns)", "Speedup", "Max error");
+
+    for (int i = 0; i < benchmarksCount; i++)
+    {
+        // Parameterized easing is sampled with its parameters as user data
+        CguiEasingTable *table = NULL;
+        if (benchmarks[i].easing == EaseElasticPro)
+            table = CguiCreateEasingTablePro(SampleElasticPro, &elasticParams, SAMPLES_COUNT);
+        else
+            table = CguiCreateEasingTable(benchmarks[i].easing, SAMPLES_COUNT);
+
+        if (!table)
+        {
+            TraceLog(LOG_ERROR, "Failed to create easing table for %s", benchmarks[i].name);
+            continue;
+        }
+
+        double direct   = MeasureDirect(benchmarks[i].easing);
+        double tabulate = MeasureTable(table);
+
+        printf("%-16s %12.2f %12.2f %7.2fx %12.2e\n",
+               benchmarks[i].name,
+               direct * 1e9 / EVALUATIONS_COUNT,
+               tabulate * 1e9 / EVALUATIONS_COUNT,
+               tabulate > 0.0 ? direct / tabulate : 0.0,
+               CguiGetEasingTableError(table));
+
+        CguiDeleteEasingTable(table);
+    }
+
+    return 0;
+}
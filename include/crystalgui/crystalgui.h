@@ -10,6 +10,10 @@
 #ifndef CRYSTALGUI_H
 #define CRYSTALGUI_H
 
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
 #include "raylib.h"
 
 #ifndef CGAPI
@@ -66,6 +70,10 @@
 #define CG_LOG_FATAL(...) CG_LOG(LOG_FATAL, __VA_ARGS__)
 #endif
 
+#ifndef CG_DELETE_QUEUE_FRAME_LIMIT
+#define CG_DELETE_QUEUE_FRAME_LIMIT 64 // Maximum number of queued nodes deleted per update (each along with all its children)
+#endif
+
 #ifndef CG_NO_MACRO_DSL // Disable DSL-like macros
 
 #define CG_NODE(node, ...) CguiInsertChildren(node, __VA_ARGS__, NULL)
@@ -159,7 +167,8 @@ typedef enum CguiTextJustify {
     CGUI_TEXT_JUSTIFY_SPACE_BETWEEN ///< Add space between words.
 } CguiTextJustify;
 
-CGAPI void CguiDrawTextPro(const char *text, Font font, Rectangle bounds, float fontSize, float spacing, float lineSpacing, Color color, int xJustify, int yJustify); ///< Draw text with word-wrapping.
+CGAPI void      CguiDrawTextPro(const char *text, Font font, Rectangle bounds, float fontSize, float spacing, float lineSpacing, Color color, int xJustify, int yJustify); ///< Draw text with word-wrapping.
+CGAPI Rectangle CguiGetTextBounds(const char *text, Font font, Rectangle bounds, float fontSize, float spacing, float lineSpacing, int xJustify, int yJustify);            ///< Get the area covered by text drawn with `CguiDrawTextPro()` parameters (may be outside the bounds).
 
 // Textures
 
@@ -170,21 +179,23 @@ CGAPI void CguiDrawRenderTextureDest(RenderTexture renderTexture, Rectangle dest
 CGAPI void CguiDrawRenderTextureFullscreen(RenderTexture renderTexture, Color tint);                  ///< Draw render texture stretched to the size of the screen (NOTE: Flips the render texture's y axis).
 CGAPI void CguiDrawRenderTextureFullscreenEx(RenderTexture renderTexture, Rectangle src, Color tint); ///< Draw render texture stretched to the size of the screen with extended parameters (NOTE: Flips the render texture's y axis).
 
-CGAPI Vector2   CguiGetTextureSizeV(Texture texture);                     ///< Return texture's width and height as Vector2.
-CGAPI Rectangle CguiGetTextureSizeRec(Texture texture);                   ///< Return texture's width and height as Rectangle (positioned zero).
-CGAPI Vector2   CguiGetRenderTextureSizeV(RenderTexture renderTexture);   ///< Return render texture's width and height as Vector2 (NOTE: height is negated).
-CGAPI Rectangle CguiGetRenderTextureSizeRec(RenderTexture renderTexture); ///< Return render texture's width and height as Rectangle (NOTE: height is negated, and positioned zero).
+CGAPI Vector2   CguiGetTextureSizeV(Texture texture);                                     ///< Return texture's width and height as Vector2.
+CGAPI Rectangle CguiGetTextureSizeRec(Texture texture);                                   ///< Return texture's width and height as Rectangle (positioned zero).
+CGAPI Vector2   CguiGetRenderTextureSizeV(RenderTexture renderTexture);                   ///< Return render texture's width and height as Vector2 (NOTE: height is negated).
+CGAPI Rectangle CguiGetRenderTextureSizeRec(RenderTexture renderTexture);                 ///< Return render texture's width and height as Rectangle (NOTE: height is negated, and positioned zero).
+CGAPI Rectangle CguiGetTextureQuadBounds(Rectangle dest, Vector2 origin, float rotation); ///< Get the area covered by a texture drawn with `DrawTexturePro()` parameters.
 
 // Display sizes
 
-CGAPI Vector2   CguiGetScreenSizeV(void);           ///< Get screen size in Vector2 form.
-CGAPI Rectangle CguiGetScreenSizeRec(void);         ///< Get screen size in Rectangle form (positioned zero).
-CGAPI Vector2   CguiGetMonitorSizeV(int monitor);   ///< Get monitor size in Vector2 form.
-CGAPI Rectangle CguiGetMonitorSizeRec(int monitor); ///< Get monitor size in Rectangle form.
-CGAPI int       CguiGetAppWidth(void);              ///< Get current monitor width if app is fullscreen mode, else get screen width.
-CGAPI int       CguiGetAppHeight(void);             ///< Get current monitor height if app is fullscreen mode, else get screen height.
-CGAPI Vector2   CguiGetAppSizeV(void);              ///< Get current monitor size if app is fullscreen mode, else get screen width and height in Vector2 form.
-CGAPI Rectangle CguiGetAppSizeRec(void);            ///< Get current monitor size if app is fullscreen mode, else get screen width and height in Rectangle form.
+CGAPI Vector2   CguiGetScreenSizeV(void);              ///< Get screen size in Vector2 form.
+CGAPI Rectangle CguiGetScreenSizeRec(void);            ///< Get screen size in Rectangle form (positioned zero).
+CGAPI Vector2   CguiGetMonitorSizeV(int monitor);      ///< Get monitor size in Vector2 form.
+CGAPI Rectangle CguiGetMonitorSizeRec(int monitor);    ///< Get monitor size in Rectangle form.
+CGAPI int       CguiGetAppWidth(void);                 ///< Get current monitor width if app is fullscreen mode, else get screen width (unless overridden).
+CGAPI int       CguiGetAppHeight(void);                ///< Get current monitor height if app is fullscreen mode, else get screen height (unless overridden).
+CGAPI Vector2   CguiGetAppSizeV(void);                 ///< Get current monitor size if app is fullscreen mode, else get screen width and height in Vector2 form.
+CGAPI Rectangle CguiGetAppSizeRec(void);               ///< Get current monitor size if app is fullscreen mode, else get screen width and height in Rectangle form.
+CGAPI void      CguiSetAppSize(int width, int height); ///< Override the app size (e.g., to render without a window), zero to stop overriding.
 
 // Misc.
 
@@ -202,9 +213,13 @@ CGAPI Color     CguiColorFromVecHSLA(Vector4 hsla);
 CGAPI Vector3   CguiColorToHSLA(Color color);                                                 ///< Get HSL color model from color.
 CGAPI Vector4   CguiColorToVecHSLA(Color color);                                              ///< Get HSL color model with alpha from color.
 CGAPI void      CguiBeginScissorModeRec(Rectangle area);                                      ///< Begin scissor mode (define a screen area for following drawing) using rectangle.
+CGAPI bool      CguiPushScissorRec(Rectangle area);                                           ///< Begin scissor mode within the current scissor area (nestable), returns false if not pushed.
+CGAPI void      CguiPopScissor(void);                                                         ///< End the last pushed scissor area, restoring the previous one.
+CGAPI Rectangle CguiGetScissorRec(void);                                                      ///< Get the current pushed scissor area, the app size if none.
 CGAPI Rectangle CguiFlipRectangleX(Rectangle rec, float axis);                                ///< Flip rectangle in X-axis.
 CGAPI Rectangle CguiFlipRectangleY(Rectangle rec, float axis);                                ///< Flip rectangle in Y-axis.
 CGAPI Rectangle CguiFlipRectangleXY(Rectangle rec, Vector2 axis);                             ///< Flip rectangle in X- and Y-axis.
+CGAPI Rectangle CguiGetRectangleUnion(Rectangle a, Rectangle b);                              ///< Get the smallest rectangle containing both rectangles.
 
 //------------------------------------------------------------------------------
 // Easing Functions
@@ -313,6 +328,133 @@ CGAPI float CguiEaseOutBouncePro(float t, float b1, float b2, float b3, float b4
 CGAPI float CguiEaseInBouncePro(float t, float b1, float b2, float b3, float b4, float c1, float c2, float c3, float c4);
 CGAPI float CguiEaseInOutBouncePro(float t, float b1, float b2, float b3, float b4, float c1, float c2, float c3, float c4);
 
+// Easing tables
+// An easing is sampled into a table once and evaluated by linear
+// interpolation between the nearest samples, without calling the easing.
+// The maximum error is estimated when the table is created, against the
+// easing itself at evenly spaced points between the samples (8 steps per
+// interval), a larger error between the points may be missed.
+//
+// - Sampler with user data allows sampling the parameterized (Pro) easings.
+// - Input t is clamped to the range [0..1].
+
+typedef float (*CguiEasingSampler)(float t, void *userData); ///< Easing function with user data to sample tables from.
+
+/// Precomputed easing table.
+typedef struct CguiEasingTable {
+    float *samples;      ///< Evenly spaced samples of the easing in the range [0..1].
+    int    samplesCount; ///< Number of samples (at least 2).
+    float  maxError;     ///< Estimated maximum absolute error of the evaluation (sampled at creation).
+} CguiEasingTable;
+
+CGAPI CguiEasingTable *CguiCreateEasingTable(CguiEasingFunction easing, int samplesCount);                    ///< Create a table by sampling an easing function.
+CGAPI CguiEasingTable *CguiCreateEasingTablePro(CguiEasingSampler sampler, void *userData, int samplesCount); ///< Create a table by sampling an easing with user data.
+CGAPI void             CguiDeleteEasingTable(CguiEasingTable *table);                                         ///< Delete an easing table.
+CGAPI float            CguiEvalEasingTable(const CguiEasingTable *table, float t);                            ///< Evaluate the easing from the table.
+CGAPI float            CguiGetEasingTableError(const CguiEasingTable *table);                                 ///< Get the estimated maximum absolute error of the table.
+
+// Batch easing
+// Easings of a kind are evaluated for arrays of t at once. The polynomial,
+// Sine, Expo, Circ, Back and Bounce easings are vectorized, the instruction set
+// is chosen at runtime (AVX2, SSE2, NEON, or scalar without SIMD).
+//
+// - Vectorized results may differ from the easing functions by float rounding.
+// - Other kinds (e.g., Elastic) call the easing function for each t.
+
+/// Easing kind, ordered by family (in, out, in-out).
+typedef enum CguiEasingKind {
+    CGUI_EASING_LINEAR,         ///< Linear easing.
+    CGUI_EASING_IN_QUAD,        ///< Quadratic ease in.
+    CGUI_EASING_OUT_QUAD,       ///< Quadratic ease out.
+    CGUI_EASING_IN_OUT_QUAD,    ///< Quadratic ease in-out.
+    CGUI_EASING_IN_CUBIC,       ///< Cubic ease in.
+    CGUI_EASING_OUT_CUBIC,      ///< Cubic ease out.
+    CGUI_EASING_IN_OUT_CUBIC,   ///< Cubic ease in-out.
+    CGUI_EASING_IN_QUART,       ///< Quartic ease in.
+    CGUI_EASING_OUT_QUART,      ///< Quartic ease out.
+    CGUI_EASING_IN_OUT_QUART,   ///< Quartic ease in-out.
+    CGUI_EASING_IN_QUINT,       ///< Quintic ease in.
+    CGUI_EASING_OUT_QUINT,      ///< Quintic ease out.
+    CGUI_EASING_IN_OUT_QUINT,   ///< Quintic ease in-out.
+    CGUI_EASING_IN_SEXTIC,      ///< Sextic ease in.
+    CGUI_EASING_OUT_SEXTIC,     ///< Sextic ease out.
+    CGUI_EASING_IN_OUT_SEXTIC,  ///< Sextic ease in-out.
+    CGUI_EASING_IN_SEPTIC,      ///< Septic ease in.
+    CGUI_EASING_OUT_SEPTIC,     ///< Septic ease out.
+    CGUI_EASING_IN_OUT_SEPTIC,  ///< Septic ease in-out.
+    CGUI_EASING_IN_OCTIC,       ///< Octic ease in.
+    CGUI_EASING_OUT_OCTIC,      ///< Octic ease out.
+    CGUI_EASING_IN_OUT_OCTIC,   ///< Octic ease in-out.
+    CGUI_EASING_IN_NONIC,       ///< Nonic ease in.
+    CGUI_EASING_OUT_NONIC,      ///< Nonic ease out.
+    CGUI_EASING_IN_OUT_NONIC,   ///< Nonic ease in-out.
+    CGUI_EASING_IN_SINE,        ///< Sine ease in.
+    CGUI_EASING_OUT_SINE,       ///< Sine ease out.
+    CGUI_EASING_IN_OUT_SINE,    ///< Sine ease in-out.
+    CGUI_EASING_IN_EXPO,        ///< Exponential ease in.
+    CGUI_EASING_OUT_EXPO,       ///< Exponential ease out.
+    CGUI_EASING_IN_OUT_EXPO,    ///< Exponential ease in-out.
+    CGUI_EASING_IN_CIRC,        ///< Circular ease in.
+    CGUI_EASING_OUT_CIRC,       ///< Circular ease out.
+    CGUI_EASING_IN_OUT_CIRC,    ///< Circular ease in-out.
+    CGUI_EASING_IN_BACK,        ///< Back ease in.
+    CGUI_EASING_OUT_BACK,       ///< Back ease out.
+    CGUI_EASING_IN_OUT_BACK,    ///< Back ease in-out.
+    CGUI_EASING_IN_ELASTIC,     ///< Elastic ease in.
+    CGUI_EASING_OUT_ELASTIC,    ///< Elastic ease out.
+    CGUI_EASING_IN_OUT_ELASTIC, ///< Elastic ease in-out.
+    CGUI_EASING_IN_BOUNCE,      ///< Bounce ease in.
+    CGUI_EASING_OUT_BOUNCE,     ///< Bounce ease out.
+    CGUI_EASING_IN_OUT_BOUNCE,  ///< Bounce ease in-out.
+    CGUI_EASING_MAX
+} CguiEasingKind;
+
+CGAPI CguiEasingFunction CguiGetEasingFunction(int kind);                                ///< Get the easing function of a kind (NULL if invalid).
+CGAPI void               CguiEaseBatch(int kind, const float *t, float *out, int count); ///< Evaluate the easing of a kind for each t (out may be t).
+CGAPI const char        *CguiGetEaseBatchInstructionSet(void);                           ///< Get the name of the instruction set used by batch easing.
+
+// Keyframe timelines
+// A timeline has tracks of keys (time and value of floats) for properties,
+// keys of each track are sorted by time. Evaluation finds the segment by
+// binary search, so each track costs O(log keys) per frame.
+//
+// - Easing kind of a key eases the segment from the key to the next key.
+// - Time before the first key or after the last key holds the value of the key.
+// - Keys of created timelines are unset until set, and each key must be set
+//   in time order with the set keys around it. Timelines are exported once all
+//   their keys are set.
+// - Timelines are stored in a compact binary format (little-endian, 4 byte
+//   aligned) that is evaluated in place. Loading validates the tracks and the
+//   key times once (O(keys)), the values are not parsed. Since the format is
+//   not byte-swapped, timelines fail to create or load on big-endian hosts.
+// - Timelines loaded from memory (e.g., memory-mapped files) reference the
+//   memory, and they cannot be modified.
+
+/// Keyframe timeline.
+typedef struct CguiTimeline {
+    int   tracksCount; ///< Number of tracks.
+    void *data;        ///< Internal: Data in the binary format.
+    int   dataSize;    ///< Internal: Size of the data in bytes.
+    bool  ownsData;    ///< Internal: Whether the data is owned (and writable).
+
+    struct CguiTimelineHeader *header;  ///< Internal: Header in the data.
+    struct CguiTimelineTrack  *tracks;  ///< Internal: Tracks in the data.
+    float                     *times;   ///< Internal: Times of keys of all tracks.
+    unsigned int              *easings; ///< Internal: Easing kinds of keys of all tracks.
+    float                     *values;  ///< Internal: Values of keys of all tracks.
+} CguiTimeline;
+
+CGAPI CguiTimeline *CguiCreateTimeline(int tracksCount, const int *keysCounts, const int *componentsCounts);                    ///< Create a timeline with tracks of keys count and components count each.
+CGAPI CguiTimeline *CguiLoadTimeline(const char *fileName);                                                                     ///< Load a timeline from a file.
+CGAPI CguiTimeline *CguiLoadTimelineFromMemory(const void *data, int dataSize);                                                 ///< Load a timeline referencing the data (must outlive the timeline).
+CGAPI void          CguiUnloadTimeline(CguiTimeline *timeline);                                                                 ///< Unload a timeline.
+CGAPI bool          CguiExportTimeline(const CguiTimeline *timeline, const char *fileName);                                     ///< Export a timeline to a file (fails if any key is unset).
+CGAPI bool          CguiSetTimelineKey(CguiTimeline *timeline, int track, int key, float time, const float *value, int easing); ///< Set a key of a track (between the set keys around it).
+CGAPI int           CguiGetTimelineTrackComponents(const CguiTimeline *timeline, int track);                                    ///< Get the number of floats in values of a track.
+CGAPI float         CguiGetTimelineDuration(const CguiTimeline *timeline);                                                      ///< Get the time of the last set key among all tracks.
+CGAPI bool          CguiEvalTimelineTrack(const CguiTimeline *timeline, int track, float time, float *out);                     ///< Evaluate the value of a track at time.
+CGAPI void          CguiEvalTimeline(const CguiTimeline *timeline, float time, float *const *outs);                             ///< Evaluate all tracks at time (NULL outputs are skipped).
+
 //------------------------------------------------------------------------------
 // Events
 //------------------------------------------------------------------------------
@@ -341,6 +483,9 @@ CGAPI float CguiEaseInOutBouncePro(float t, float b1, float b2, float b3, float
 struct CguiNode;
 typedef struct CguiNode CguiNode;
 
+struct CguiNodeIndex;
+typedef struct CguiNodeIndex CguiNodeIndex;
+
 /// Event type for GUI events.
 typedef enum CguiEventType {
     CGUI_EVENT_TYPE_MOUSE_CURSOR_MOVE,    ///< Event when mouse cursor moves.
@@ -436,26 +581,38 @@ typedef struct CguiTransformation {
     Vector2 shrink;             ///< Shrinking when size is relative to parent (0, 0 -> no shrinking, 20, 10 -> shrink node 20, 10 units smaller than parent, etc.).
 } CguiTransformation;
 
-typedef void (*CguiNodeFunction)(CguiNode *node);                          ///< General function to perform action to the node.
-typedef bool (*CguiTransformNodeFunction)(CguiNode *node);                 ///< Transform function to update the node's transformation. Return true if transform changed.
-typedef bool (*CguiHandleEventFunction)(CguiNode *node, CguiEvent *event); ///< Handle event. Return true if consumed.
+typedef void (*CguiNodeFunction)(CguiNode *node);                           ///< General function to perform action to the node.
+typedef bool (*CguiTransformNodeFunction)(CguiNode *node);                  ///< Transform function to update the node's transformation. Return true if transform changed.
+typedef bool (*CguiHandleEventFunction)(CguiNode *node, CguiEvent *event);  ///< Handle event. Return true if consumed.
+typedef Rectangle (*CguiNodeBoundsFunction)(CguiNode *node);                ///< Get an area of the node for drawing (e.g., visual bounds, opaque bounds).
+typedef bool (*CguiCopyNodeFunction)(CguiNode *fromNode, CguiNode *toNode); ///< Copy resources owned by the data of a node to the node it was copied to. Return true if copied.
 
 /// GUI node for nesting.
 struct CguiNode {
-    bool  enabled;  ///< Toggle the entire node (updates, renders, event handling, etc.).
-    char *name;     ///< Name of the node. Names starting with "Cgui" are reserved (auto-freed).
-    int   type;     ///< Type of the node (for polymorphism). Numbers in form of 0x00FFxxxx are reserved.
-    void *data;     ///< Node data (auto-freed).
-    int   dataSize; ///< Number of bytes of data.
+    bool  enabled;      ///< Toggle the entire node (updates, renders, event handling, etc.).
+    char *name;         ///< Name of the node. Names starting with "Cgui" are reserved (auto-freed).
+    int   type;         ///< Type of the node (for polymorphism). Numbers in form of 0x00FFxxxx are reserved.
+    void *data;         ///< Node data (auto-freed).
+    int   dataSize;     ///< Number of bytes of data.
+    bool  deleteQueued; ///< Internal: Whether the node is queued for deletion.
+    bool  occluded;     ///< Internal: Whether the node was found covered by later drawn nodes in the last draw.
+    int   handleSlot;   ///< Internal: Slot of the node in the handle table plus one (0 if the node has no handle yet).
 
     CguiTransformation transformation; ///< Transformation of the node. Apply for recache when modifying.
     Rectangle          bounds;         ///< Calculated bounds of the node.
     bool               rebound;        ///< Whether to recalculate bounds. Another way to trigger rebound is to return true from the attached transform function.
+    bool               clipChildren;   ///< Whether children are clipped to the bounds (culled from drawing and collision check outside them).
+    bool               cullChildren;   ///< Whether children are drawn within the visual bounds, so the children are culled along with the node.
 
     CguiNode  *parent;           ///< Reference to parent node.
     CguiNode **children;         ///< Children nodes (node owns its children).
     int        childrenCount;    ///< Number of children nodes.
     int        childrenCapacity; ///< Number of children that can be inserted before reallocation.
+    int        childIndex;       ///< Index of this node in the parent's children (maintained on insertion/removal).
+
+    CguiNodeIndex *index;      ///< Internal: Lookup index this node is in (NULL if not indexed).
+    CguiNode      *prevOfType; ///< Internal: Previous node of the same type in the lookup index.
+    CguiNode      *nextOfType; ///< Internal: Next node of the same type in the lookup index.
 
     // Instance node of a template node will copy all properties excluding the below
     // Reoverriding the fields is up to you using the override field
@@ -464,6 +621,7 @@ struct CguiNode {
     CguiNode       **instances;         ///< References to instance nodes (node does not owns references).
     int              instancesCount;    ///< Number of instance nodes.
     int              instancesCapacity; ///< Number of instance that can be inserted before reallocation.
+    int              instanceIndex;     ///< Index of this node in the template source's instances (maintained on linking/unlinking).
     bool             resync;            ///< Whether to sync instances from this node.
     void            *instanceData;      ///< Data specific to instance.
     int              instanceDataSize;  ///< Number of bytes of instance data.
@@ -477,7 +635,10 @@ struct CguiNode {
     CguiNodeFunction          drawPre;        ///< Draw function (called before all children).
     CguiNodeFunction          drawPost;       ///< Draw function (called after all children).
     CguiNodeFunction          debugDraw;      ///< Debug-draw function.
-    CguiNodeFunction          deleteNodeData; ///< Delete function.
+    CguiNodeFunction          deleteNodeData; ///< Delete function (also called before the data is overwritten by a copy).
+    CguiCopyNodeFunction      copyNodeData;   ///< Copy function (called on the copy after the data is copied, e.g., to duplicate resources owned by the data).
+    CguiNodeBoundsFunction    visualBounds;   ///< Visual bounds function, bounds including anything drawn outside of them (for culling, bounds are used if NULL).
+    CguiNodeBoundsFunction    opaqueBounds;   ///< Opaque bounds function, area fully covered when drawn (for occlusion culling, nothing if NULL).
 
     bool                    canHandleMouseEvents;    ///< Handle mouse events.
     bool                    canHandleKeyboardEvents; ///< Handle keyboard events.
@@ -493,6 +654,8 @@ CGAPI CguiNode *CguiCreateNodePro(CguiTransformation transformation, const char
 CGAPI CguiNode *CguiCreateNodeProMax(CguiTransformation transformation, const char *name, int type, const void *data, int dataSize, const void *instanceData, int instanceDataSize); ///< Create a new named node with type and optional data and instance data.
 CGAPI void      CguiDeleteNode(CguiNode *node);                                                                                                                                      ///< Delete a node (this will deallocate children).
 CGAPI void      CguiDeleteNodeSelf(CguiNode *node);                                                                                                                                  ///< Delete a node (this does not deallocate children).
+CGAPI bool      CguiQueueDeleteNode(CguiNode *node);                                                                                                                                 ///< Queue a node to be deleted at the end of update (the node is disabled until then, it is safe to call from handlers).
+CGAPI int       CguiFlushDeleteQueue(int maxCount);                                                                                                                                  ///< Delete queued nodes in one sweep (at most maxCount, or all if <= 0), returns the number of nodes left in the queue.
 CGAPI bool      CguiRenameNode(CguiNode *node, const char *newName);                                                                                                                 ///< Rename a node.
 
 CGAPI void CguiTransformNode(CguiNode *node, bool rebound);     ///< Transform a node recursively (parent first).
@@ -509,6 +672,54 @@ CGAPI void CguiDebugDrawNodeSelf(CguiNode *node);               ///< Debug-draw
 CGAPI CguiNode *CguiCloneNode(CguiNode *node);     ///< Duplicate a node and its children.
 CGAPI CguiNode *CguiCloneNodeSelf(CguiNode *node); ///< Duplicate a node without its children.
 
+// Node handles
+//
+// A handle is a small value (slot index and generation) referring to a node,
+// that can be stored in place of a node pointer. Resolving a handle is
+// constant time and returns NULL once the node is deleted, the slot of a
+// deleted node is reused with a new generation.
+//
+// - A node gets its slot when its handle is requested for the first time.
+// - Handles can be copied around freely (e.g., across threads), but resolving
+//   them and deleting nodes must be done on the same thread.
+
+/// Generational node handle. Zero-initialized handle is never valid.
+typedef struct CguiNodeHandle {
+    unsigned int index;      ///< Slot index in the handle table.
+    unsigned int generation; ///< Generation of the slot at the time the handle was made.
+} CguiNodeHandle;
+
+CGAPI CguiNodeHandle CguiGetNodeHandle(CguiNode *node);        ///< Get the handle of a node, returns a zero handle on failure.
+CGAPI CguiNode      *CguiResolveHandle(CguiNodeHandle handle); ///< Get the node of a handle, returns NULL if the node was deleted.
+
+// Culling
+//
+// Drawing a node skips the nodes whose visual bounds lie entirely outside
+// the window, the active scissor area (`CguiPushScissorRec()`) and the bounds
+// of the nodes clipping their children. Only the culled node's own draw
+// functions are skipped, its children are checked individually unless the
+// node declares them within its visual bounds (`cullChildren`).
+//
+// - Nodes drawing outside their bounds (e.g., shadows, rotated textures)
+//   declare it using the `visualBounds` function.
+// - Nodes whose draw functions affect drawing their children (e.g., scissor,
+//   shader mode) should set `cullChildren` (or `clipChildren`), so that both
+//   are culled together.
+//
+// Before drawing, the visible nodes are also checked against the opaque areas
+// of the nodes drawn after them. A node whose visual bounds are entirely
+// covered by one of them is occluded and its pre-draw is skipped.
+//
+// - Nodes declare the area they fully cover using the `opaqueBounds` function.
+// - Nodes with post-draw functions are never occluded (it may restore state).
+// - Only the largest few opaque areas are tracked as occluders.
+
+CGAPI Rectangle CguiGetNodeVisualBounds(CguiNode *node);                              ///< Get the visual bounds of a node, the bounds if it does not declare any.
+CGAPI Rectangle CguiGetNodeOpaqueBounds(CguiNode *node);                              ///< Get the opaque bounds of a node, an empty rectangle if it does not declare any.
+CGAPI Rectangle CguiClipNodeChildren(CguiNode *node, Rectangle clip);                 ///< Get the clip area of the node's children within the node's clip area.
+CGAPI bool      CguiIsNodeCulled(CguiNode *node, Rectangle clip, bool *cullChildren); ///< Check whether the node is drawn outside the clip area, and if so whether its children are too (optional).
+CGAPI void      CguiOccludeNodes(CguiNode *const *nodes, int count);                  ///< Mark the visible nodes (in draw order) covered by the opaque areas of the nodes drawn after them.
+
 // Templating
 
 CGAPI CguiNode *CguiCreateInstance(CguiNode *templateNode);                          ///< Create an instance from a template node and its children.
@@ -517,7 +728,7 @@ CGAPI void      CguiApplyTemplateResync(CguiNode *node);
 CGAPI bool      CguiLinkTemplate(CguiNode *node, CguiNode *templateNode);            ///< Link this node to be updated with the template.
 CGAPI bool      CguiUnlinkTemplate(CguiNode *node);                                  ///< Unlink this node from being updated with the template.
 CGAPI bool      CguiSetInstancesCapacity(CguiNode *node, int newCapacity);           ///< Set instances capacity (if capacity >= count).
-CGAPI int       CguiFindInstanceIndex(CguiNode *templateSource, CguiNode *instance); ///< Find direct instance in source and return an index, -1 if not found.
+CGAPI int       CguiFindInstanceIndex(CguiNode *templateSource, CguiNode *instance); ///< Find direct instance in source and return an index, -1 if not found (constant time for linked instances).
 CGAPI void      CguiSyncInstances(CguiNode *node, bool resync);                      ///< Syncs this node if it has attached template source and traverse instances recursively (parent first).
 CGAPI bool      CguiSyncInstancesSelf(CguiNode *node, bool resync);                  ///< Syncs this node itself if it has attached template source (non-recursively).
 CGAPI void      CguiSyncHierarchy(CguiNode *node);                                   ///< Sync all instances as well as all children's instances.
@@ -582,14 +793,127 @@ CGAPI bool      CguiCopyNodeValues(CguiNode *fromNode, CguiNode *toNode);     //
 CGAPI bool      CguiCopyNodeValuesNoTi(CguiNode *fromNode, CguiNode *toNode); ///< Copy all excluding hierarchy and template/instance fields from one node to another.
 CGAPI bool      CguiCopyNode(CguiNode *fromNode, CguiNode *toNode);           ///< Copy all excluding fields from one node to another (recursively, if structure matches).
 CGAPI bool      CguiCopyNodeNoTi(CguiNode *fromNode, CguiNode *toNode);       ///< Copy all excluding template/instance fields from one node to another (recursively, if structure matches).
-CGAPI int       CguiFindChildIndex(CguiNode *parent, CguiNode *child);        ///< Find the direct child in parent and return an index, -1 if not found.
+CGAPI int       CguiFindChildIndex(CguiNode *parent, CguiNode *child);        ///< Find the direct child in parent and return an index, -1 if not found (constant time for attached children).
 CGAPI bool      CguiIsDescendantOf(CguiNode *parent, CguiNode *child);        ///< Check if a node is a child of parent (recursively).
 CGAPI bool      CguiIsAncestorOf(CguiNode *child, CguiNode *parent);          ///< Check if a node is a parent of child (recursively).
 CGAPI CguiNode *CguiFindTypeInChildren(CguiNode *parent, int type);           ///< Returns the first found node type in itself or children (recursively), NULL if not found.
 CGAPI CguiNode *CguiFindTypeInParents(CguiNode *child, int type);             ///< Returns the first found node type in itself or parents (recursively), NULL if not found.
 CGAPI Rectangle CguiComputeNodeBounds(CguiNode *node);                        ///< Compute node bounds recursively for recache applied nodes.
+CGAPI Rectangle CguiComputeBounds(CguiTransformation t, Rectangle pBounds);   ///< Compute bounds of a transformation in the parent bounds.
 CGAPI CguiNode *CguiCheckCollision(CguiNode *node, Vector2 point);            ///< Check for collision with the bounds of to top-most drawn node (child-most, or last child in case of overlap) under the point, returns NULL if none.
 
+// Batched bounds
+//
+// Bounds of many nodes can be computed at once from structure-of-arrays inputs
+// (one array per transformation field and parent bounds field, per axis).
+// The transform pass uses this for wide nodes whose children are all being
+// rebounded (e.g., on window resize). SIMD (AVX, SSE or NEON) is used when
+// available, define CG_NO_SIMD to use the scalar fallback only.
+
+CGAPI void CguiComputeBoundsAxisBatch(const float *position, const float *size, const float *isRelativePosition, const float *isRelativeSize, const float *anchor, const float *shrink, const float *pPosition, const float *pSize, float *outPosition, float *outSize, int count); ///< Compute one axis (position and size) of many bounds at once.
+
+// Compiled tree
+//
+// A compiled tree is an optional flattened view of a node tree: the nodes are
+// stored in pre-order (parent first) as compact records, so that the per-frame
+// passes (transform, collision check and draw) run linearly over an array
+// instead of chasing children pointers across the heap.
+//
+// - The records are rebuilt automatically before a pass if the tree structure
+//   changed (children inserted/removed/deleted) or if copying node values
+//   changed the fields kept in the records.
+// - Changing `enabled`, `clipChildren` or the transform/draw handlers of a
+//   node directly does not rebuild the records, call
+//   `CguiInvalidateCompiledTrees()` afterwards.
+// - Bounds are read from the nodes, so the compiled and the node passes can
+//   be mixed freely.
+// - Like the node passes, compiled draw culls and occludes nodes, and the
+//   collision check skips the children of clipping nodes outside their
+//   bounds. Both skip the subtrees of disabled nodes.
+// - The compiled tree does not own the root; delete the compiled tree first.
+// - Transform handlers may change the children of their own node (e.g.,
+//   virtual list), the subtree is then transformed by the node pass until the
+//   records are rebuilt. Other handlers must not modify the tree structure
+//   during a compiled pass, the remaining records of the pass are skipped if
+//   they do.
+
+/// Compiled node record (compact copy of the per-frame fields of a node).
+typedef struct CguiCompiledNode {
+    CguiNode                 *node;           ///< Source node.
+    int                       parent;         ///< Index of the parent record (-1 for the root record).
+    int                       clipParent;     ///< Index of the closest ancestor record clipping its children (-1 if none).
+    int                       subtreeSize;    ///< Number of records in the subtree (including itself).
+    bool                      enabled;        ///< Whether the node and all its parents are enabled.
+    bool                      rebound;        ///< Internal: Propagated rebound of the last transform pass.
+    bool                      culled;         ///< Internal: Whether the node was culled in the last draw pass.
+    bool                      cullChildren;   ///< Internal: Whether the children were culled along with the node in the last draw pass.
+    Rectangle                 clip;           ///< Internal: Clip area of the children in the last draw pass.
+    CguiTransformNodeFunction transform;      ///< Transform function.
+    CguiNodeFunction          drawPre;        ///< Draw function (called before all children).
+    CguiNodeFunction          drawPost;       ///< Draw function (called after all children).
+} CguiCompiledNode;
+
+/// Compiled (flattened) node tree.
+typedef struct CguiCompiledTree {
+    CguiNode         *root;          ///< Root node of the tree (tree does not own the root).
+    CguiCompiledNode *nodes;         ///< Node records in pre-order (parent first).
+    CguiNode        **visibleNodes;  ///< Internal: Nodes drawn in the last draw pass, in draw order (same capacity as records).
+    int               nodesCount;    ///< Number of node records.
+    int               nodesCapacity; ///< Number of node records that can be inserted before reallocation.
+    bool              compiled;      ///< Internal: Whether the records were built.
+    unsigned int      version;       ///< Internal: Tree structure version the records were built from.
+} CguiCompiledTree;
+
+CGAPI CguiCompiledTree *CguiCreateCompiledTree(CguiNode *root);                            ///< Create a compiled tree for the root node (compiled lazily).
+CGAPI void              CguiDeleteCompiledTree(CguiCompiledTree *tree);                    ///< Delete a compiled tree (this does not deallocate the nodes).
+CGAPI bool              CguiCompileTree(CguiCompiledTree *tree);                           ///< Rebuild the records if the tree structure changed, returns true if records are valid.
+CGAPI void              CguiInvalidateCompiledTrees(void);                                 ///< Force all compiled trees to rebuild their records before the next pass.
+CGAPI void              CguiTransformCompiledTree(CguiCompiledTree *tree, bool rebound);   ///< Transform all nodes linearly (parent first).
+CGAPI void              CguiDrawCompiledTree(CguiCompiledTree *tree);                      ///< Draw all enabled nodes linearly (parent first).
+CGAPI CguiNode         *CguiCheckCompiledCollision(CguiCompiledTree *tree, Vector2 point); ///< Check for collision with the top-most drawn enabled node under the point, returns NULL if none.
+
+// Node index
+//
+// A node index is an optional lookup index of a node tree, with a hash table
+// of nodes by name and a list of nodes per type. It is kept up to date when
+// nodes are inserted, removed, renamed or copied to, so lookups stay constant
+// time (by name) or proportional to the number of matches (by type).
+//
+// - The find functions work without an index too, by searching the tree.
+// - Indexes can not be nested, a node can only be in one index. Inserting an
+//   indexed tree into an indexed tree (or indexing a tree containing one)
+//   merges its nodes into the outer index, and leaves the inner index empty
+//   with no root (it must still be deleted).
+// - Changing `name` or `type` of a node directly does not update the index,
+//   use `CguiRenameNode()` or re-create the index.
+// - The index does not own the root; delete the index first.
+// - With an index, the order of found nodes is unspecified.
+
+/// Node index entry for a type.
+typedef struct CguiNodeIndexType {
+    bool      used;  ///< Whether this entry is used.
+    int       type;  ///< Type of the nodes.
+    CguiNode *first; ///< First node of the type.
+    int       count; ///< Number of nodes of the type.
+} CguiNodeIndexType;
+
+/// Lookup index of a node tree.
+struct CguiNodeIndex {
+    CguiNode          *root;          ///< Root node of the indexed tree (index does not own the root).
+    CguiNode         **names;         ///< Internal: Hash table of nodes by name (linear probing, NULL for empty).
+    int                namesCount;    ///< Number of named nodes in the index.
+    int                namesCapacity; ///< Size of the names hash table (power of two).
+    CguiNodeIndexType *types;         ///< Internal: Hash table of types (linear probing).
+    int                typesCount;    ///< Number of types in the index.
+    int                typesCapacity; ///< Size of the types hash table (power of two).
+};
+
+CGAPI CguiNodeIndex *CguiCreateNodeIndex(CguiNode *root);                    ///< Create a lookup index of the root node and its children, NULL if root is already indexed.
+CGAPI void           CguiDeleteNodeIndex(CguiNodeIndex *index);              ///< Delete a lookup index (this does not deallocate the nodes).
+CGAPI CguiNode      *CguiFindNodeByName(CguiNode *root, const char *name);   ///< Find a node with the name in root or its children (constant time if root is indexed), NULL if not found.
+CGAPI CguiNode      *CguiFindFirstNodeOfType(CguiNode *root, int type);      ///< Find the first node of the type in root or its children, NULL if not found.
+CGAPI CguiNode      *CguiFindNextNodeOfType(CguiNode *root, CguiNode *node); ///< Find the next node of the same type after the node found in root, NULL if no more.
+
 //------------------------------------------------------------------------------
 // Layout Nodes
 //------------------------------------------------------------------------------
@@ -606,6 +930,10 @@ CGAPI CguiNode *CguiCheckCollision(CguiNode *node, Vector2 point);            //
 //
 // Note: The transformation of the items will be overridden automatically.
 // For manual positioning requirements, consider nesting a node within an item.
+//
+// Linear and grid layouts cache the inputs of their last arrangement (layout
+// size, layout data, children and item/slot data) and skip rearranging when
+// none of them changed. Clear the layout data's `cached` to force it.
 
 /// Layout node type, 0x00FF01 is the type prefix.
 typedef enum CguiLayoutNodeType {
@@ -615,6 +943,9 @@ typedef enum CguiLayoutNodeType {
     CGUI_LAYOUT_NODE_TYPE_LINEAR_ITEM,        ///< Linear node's item type.
     CGUI_LAYOUT_NODE_TYPE_GRID,               ///< Grid node type.
     CGUI_LAYOUT_NODE_TYPE_GRID_ITEM,          ///< Grid node's item type.
+    CGUI_LAYOUT_NODE_TYPE_VIRTUAL_LIST,       ///< Virtual list node type.
+    CGUI_LAYOUT_NODE_TYPE_SCROLL_VIEW,        ///< Scroll view node type.
+    CGUI_LAYOUT_NODE_TYPE_SCROLL_CONTENT,     ///< Scroll view node's content type.
 } CguiLayoutNodeType;
 
 /// Layout direction.
@@ -666,6 +997,13 @@ typedef struct CguiLinearLayoutData {
     int   direction; ///< Layout direction for items.
     int   justify;   ///< Layout justification if space is available (or exceeded).
     float spacing;   ///< Spacing between items of the layout.
+
+    bool    cached;          ///< Internal: Whether the last arrangement inputs are cached (clear to force rearrangement).
+    Vector2 cachedSize;      ///< Internal: Layout size of the last arrangement.
+    int     cachedDirection; ///< Internal: Layout direction of the last arrangement.
+    int     cachedJustify;   ///< Internal: Layout justification of the last arrangement.
+    float   cachedSpacing;   ///< Internal: Spacing of the last arrangement.
+    int     cachedCount;     ///< Internal: Number of children of the last arrangement.
 } CguiLinearLayoutData;
 
 CGAPI CguiNode *CguiCreateLinearLayout(CguiTransformation transformation, int direction, int justify, float spacing); ///< Helper to create a linear layout node.
@@ -680,6 +1018,12 @@ typedef struct CguiLinearLayoutItemData {
 
     float position; ///< Internal: Position of the item bounds.
     float size;     ///< Internal: Size of the item bounds.
+
+    CguiNode *cachedLayout;  ///< Internal: Layout node of the last arrangement.
+    int       cachedIndex;   ///< Internal: Child index of the last arrangement.
+    float     cachedWeight;  ///< Internal: Weight of the last arrangement.
+    float     cachedMinSize; ///< Internal: Minimum size of the last arrangement.
+    float     cachedMaxSize; ///< Internal: Maximum size of the last arrangement.
 } CguiLinearLayoutItemData;
 
 CGAPI CguiNode *CguiCreateLinearLayoutItem(float weight, float minSize, float maxSize); ///< Helper to create a linear layout's item node.
@@ -692,6 +1036,10 @@ typedef struct CguiGridLayoutSlotData {
 
     float position; ///< Internal: Position of the slot bounds.
     float size;     ///< Internal: Size of the slot bounds.
+
+    float cachedWeight;  ///< Internal: Weight of the last arrangement.
+    float cachedMinSize; ///< Internal: Minimum size of the last arrangement.
+    float cachedMaxSize; ///< Internal: Maximum size of the last arrangement.
 } CguiGridLayoutSlotData;
 
 /// Grid layout data.
@@ -706,6 +1054,15 @@ typedef struct CguiGridLayoutData {
     int                     xJustify;       ///< Layout justification if space in x-axis is available (or exceeded).
     int                     yJustify;       ///< Layout justification if space in y-axis is available (or exceeded).
     Vector2                 spacing;        ///< Spacing between slots of the grid.
+
+    bool    cached;            ///< Internal: Whether the last arrangement inputs are cached (clear to force rearrangement).
+    Vector2 cachedSize;        ///< Internal: Layout size of the last arrangement.
+    int     cachedXSlotsCount; ///< Internal: Number of slots in the x-axis of the last arrangement.
+    int     cachedYSlotsCount; ///< Internal: Number of slots in the y-axis of the last arrangement.
+    int     cachedXJustify;    ///< Internal: Layout justification in x-axis of the last arrangement.
+    int     cachedYJustify;    ///< Internal: Layout justification in y-axis of the last arrangement.
+    Vector2 cachedSpacing;     ///< Internal: Spacing of the last arrangement.
+    int     cachedCount;       ///< Internal: Number of children of the last arrangement.
 } CguiGridLayoutData;
 
 CGAPI CguiNode *CguiCreateGridLayout(CguiTransformation transformation, int xSlotsCount, int ySlotsCount, int xJustify, int yJustify, Vector2 spacing); ///< Helper to create a grid layout node.
@@ -727,10 +1084,113 @@ typedef struct CguiGridLayoutItemData {
     int ySlot; ///< Slot index in y-axis it should start from.
     int xSpan; ///< Number of spans in x-axis it should stretch.
     int ySpan; ///< Number of spans in y-axis it should stretch.
+
+    CguiNode *cachedLayout; ///< Internal: Layout node of the last arrangement.
+    int       cachedIndex;  ///< Internal: Child index of the last arrangement.
+    int       cachedXSlot;  ///< Internal: Slot index in x-axis of the last arrangement.
+    int       cachedYSlot;  ///< Internal: Slot index in y-axis of the last arrangement.
+    int       cachedXSpan;  ///< Internal: Number of spans in x-axis of the last arrangement.
+    int       cachedYSpan;  ///< Internal: Number of spans in y-axis of the last arrangement.
 } CguiGridLayoutItemData;
 
 CGAPI CguiNode *CguiCreateGridLayoutItem(int xSlot, int ySlot, int xSpan, int ySpan); ///< Helper to create a grid layout's item node.
 
+// Virtual list
+//
+// A virtual list arranges a (possibly huge) number of items linearly in a
+// direction like a linear layout, but only the items intersecting its bounds
+// exist as children. Item nodes are created on demand and recycled as the
+// list is scrolled: an item node scrolled out is kept in a pool and re-bound
+// to the next item scrolled in. Children are ordered by item index, so the
+// realized items are regular nodes for updating, drawing and collision check.
+//
+// - Items are sized by `itemExtentFunction` if set, otherwise all items are
+//   `itemExtent` units long. The other axis is the list's size.
+// - With `itemExtentFunction`, items are measured lazily up to the realized
+//   items, and the items not measured yet are estimated to be `itemExtent`
+//   long, so the total extent is an estimate until the list is scrolled to the
+//   end.
+// - Change `itemsCount`, `scroll`, `direction` or `spacing` directly, they are
+//   applied in the next transform. Call `CguiRefreshVirtualList()` if item
+//   extents or item contents changed.
+// - Item nodes are owned by the list; do not insert or remove its children.
+
+typedef float (*CguiVirtualListExtentFunction)(CguiNode *list, int item);                  ///< Return the extent (along the list direction) of an item.
+typedef CguiNode *(*CguiVirtualListCreateFunction)(CguiNode *list);                        ///< Create a new item node to be bound to items.
+typedef void (*CguiVirtualListBindFunction)(CguiNode *list, CguiNode *itemNode, int item); ///< Bind an item to a (new or recycled) item node.
+
+/// Virtual list data.
+/// Realize items intersecting the bounds only.
+typedef struct CguiVirtualListData {
+    int                           direction;          ///< Layout direction for items.
+    float                         spacing;            ///< Spacing between items.
+    int                           itemsCount;         ///< Number of items in the list.
+    float                         itemExtent;         ///< Extent of each item, or the estimated extent of items not measured yet with an extent function.
+    float                         scroll;             ///< Scroll offset along the direction (clamped on transform).
+    CguiVirtualListExtentFunction itemExtentFunction; ///< Item extent function (optional).
+    CguiVirtualListCreateFunction createItemFunction; ///< Item node create function.
+    CguiVirtualListBindFunction   bindItemFunction;   ///< Item bind function (optional).
+    void                         *userData;           ///< User data for the functions (not freed).
+
+    int        firstItem;       ///< Internal: Item index of the first child.
+    double    *offsets;         ///< Internal: Offset of each measured item and the offset after the last measured item (variable extent only).
+    int        offsetsCount;    ///< Internal: Number of item offsets computed (measured items + 1).
+    int        offsetsCapacity; ///< Internal: Number of item offsets that can be computed before reallocation.
+    CguiNode **pool;            ///< Internal: Item nodes not bound to any item.
+    int        poolCount;       ///< Internal: Number of pooled item nodes.
+    int        poolCapacity;    ///< Internal: Number of item nodes that can be pooled before reallocation.
+    bool       rebind;          ///< Internal: Whether to re-bind the realized items.
+    bool       cached;          ///< Internal: Whether the last arrangement inputs are cached (clear to force rearrangement).
+    Vector2    cachedSize;      ///< Internal: List size of the last arrangement.
+    int        cachedDirection; ///< Internal: Layout direction of the last arrangement.
+    float      cachedSpacing;   ///< Internal: Spacing of the last arrangement.
+    float      cachedScroll;    ///< Internal: Scroll offset of the last arrangement.
+    int        cachedCount;     ///< Internal: Number of items of the last arrangement.
+} CguiVirtualListData;
+
+CGAPI CguiNode *CguiCreateVirtualList(CguiTransformation transformation, int direction, float spacing, int itemsCount, float itemExtent, CguiVirtualListCreateFunction createItemFunction, CguiVirtualListBindFunction bindItemFunction); ///< Helper to create a virtual list node.
+CGAPI void      CguiDeleteVirtualListData(CguiNode *node);                                                                                                                                                                            ///< Delete function (attached) for virtual list node.
+CGAPI bool      CguiTransformVirtualList(CguiNode *node);                                                                                                                                                                             ///< Transform function (attached) for virtual list node.
+CGAPI void      CguiRefreshVirtualList(CguiNode *node);                                                                                                                                                                               ///< Forget the measured items and re-bind the realized items in the next transform.
+CGAPI int       CguiGetVirtualListItem(CguiNode *node, CguiNode *itemNode);                                                                                                                                                           ///< Get the item index bound to a child (or its descendant) of the list, -1 if none.
+CGAPI float     CguiGetVirtualListExtent(CguiNode *node);                                                                                                                                                                             ///< Get the total extent of all the items (including spacing), estimated for items not measured yet.
+
+// Scroll view
+//
+// A scroll view shows a part of its content node (larger than the view) and
+// scrolls it with the mouse wheel and by dragging, with kinetic movement.
+// Drawing is clipped to the view using nested scissor areas, and content
+// outside the view is skipped entirely in drawing and collision check.
+//
+// - Insert the scrolled nodes to the content node (`CguiGetScrollViewContent()`).
+// - Content size of 0 in an axis uses the view size (no scrolling in it).
+// - Dragging starts on the parts of the view where no child consumed the
+//   mouse button press.
+// - With nested views, the wheel move is taken by the innermost view under
+//   the mouse that can still scroll in its direction.
+// - Kinetic movement advances by the transition clock
+//   (`CguiGetTransitionDeltaTime()`), so it follows fixed steps and pauses.
+
+/// Scroll view data.
+typedef struct CguiScrollViewData {
+    Vector2 contentSize; ///< Size of the content.
+    Vector2 scroll;      ///< Scroll offset (clamped on transform).
+    Vector2 velocity;    ///< Scroll velocity (units per second).
+    float   wheelSpeed;  ///< Velocity added per mouse wheel move.
+    float   friction;    ///< Velocity decay rate (per second).
+
+    bool    dragging;     ///< Internal: Whether the content is being dragged.
+    Vector2 dragPosition; ///< Internal: Last mouse position while dragging.
+} CguiScrollViewData;
+
+CGAPI CguiNode *CguiCreateScrollView(CguiTransformation transformation, Vector2 contentSize); ///< Helper to create a scroll view node (with its content node).
+CGAPI bool      CguiTransformScrollView(CguiNode *node);                                      ///< Transform function (attached) for scroll view node.
+CGAPI void      CguiUpdatePreScrollView(CguiNode *node);                                      ///< Pre-update function (attached) for scroll view node.
+CGAPI void      CguiDrawPreScrollView(CguiNode *node);                                        ///< Pre-draw function (attached) for scroll view node.
+CGAPI void      CguiDrawPostScrollView(CguiNode *node);                                       ///< Post-draw function (attached) for scroll view node.
+CGAPI bool      CguiHandleEventScrollView(CguiNode *node, CguiEvent *event);                  ///< Event handler (attached) for scroll view node.
+CGAPI CguiNode *CguiGetScrollViewContent(CguiNode *node);                                     ///< Get the content node of a scroll view.
+
 //------------------------------------------------------------------------------
 // GUI Basic Element Nodes
 //------------------------------------------------------------------------------
@@ -761,6 +1221,7 @@ typedef struct CguiTextElementData {
 CGAPI CguiNode *CguiCreateTextElement(const char *text, Color color);                                                                                             ///< Helper to create a text element node.
 CGAPI CguiNode *CguiCreateTextElementPro(const char *text, Font font, float fontSize, float spacing, float lineSpacing, Color color, int xJustify, int yJustify); ///< Helper to create a text element node.
 CGAPI void      CguiDrawPreTextElement(CguiNode *node);                                                                                                           ///< Pre-draw function (attached) for text element node.
+CGAPI Rectangle CguiGetTextElementVisualBounds(CguiNode *node);                                                                                                   ///< Visual bounds function (attached) for text element node.
 CGAPI bool      CguiIsTextElementDataEqual(CguiTextElementData a, CguiTextElementData b);                                                                         ///< Check if text element data is equal.
 
 /// Basic texture element data.
@@ -775,6 +1236,7 @@ typedef struct CguiTextureElementData {
 CGAPI CguiNode *CguiCreateTextureElement(Texture texture);                                                                  ///< Helper to create a texture element node.
 CGAPI CguiNode *CguiCreateTextureElementPro(Texture texture, Rectangle source, Vector2 origin, float rotation, Color tint); ///< Helper to create a texture element node.
 CGAPI void      CguiDrawPreTextureElement(CguiNode *node);                                                                  ///< Pre-draw function (attached) for texture element node.
+CGAPI Rectangle CguiGetTextureElementVisualBounds(CguiNode *node);                                                          ///< Visual bounds function (attached) for texture element node.
 CGAPI bool      CguiIsTextureElementDataEqual(CguiTextureElementData a, CguiTextureElementData b);                          ///< Check if texture element data is equal.
 
 /// Basic box element data.
@@ -798,8 +1260,141 @@ CGAPI CguiNode *CguiCreateBoxElement(float radius, Color color);
 CGAPI CguiNode *CguiCreateBoxElementEx(float radius, Color color, float shadowDistance, Color shadowColor, float borderThickness, Color borderColor);                                                                                                            ///< Helper to create a box element node with extended parameters.
 CGAPI CguiNode *CguiCreateBoxElementPro(Vector4 radii, Color color, Texture texture, float shadowDistance, Vector2 shadowOffset, float shadowShrink, Color shadowColor, Texture shadowTexture, float borderThickness, Color borderColor, Texture borderTexture); ///< Helper to create a box element node with pro parameters.
 CGAPI void      CguiDrawPreBoxElement(CguiNode *node);                                                                                                                                                                                                           ///< Pre-draw function (attached) for box element node.
+CGAPI Rectangle CguiGetBoxElementVisualBounds(CguiNode *node);                                                                                                                                                                                                   ///< Visual bounds function (attached) for box element node.
+CGAPI Rectangle CguiGetBoxElementOpaqueBounds(CguiNode *node);                                                                                                                                                                                                   ///< Opaque bounds function (attached) for box element node.
+CGAPI Rectangle CguiGetBoxVisualBounds(Rectangle bounds, CguiBoxElementData data);                                                                                                                                                                               ///< Get the visual bounds of a box drawn in the bounds (including the shadow).
 CGAPI bool      CguiIsBoxElementDataEqual(CguiBoxElementData a, CguiBoxElementData b);                                                                                                                                                                           ///< Check if box element data is equal.
 
+//------------------------------------------------------------------------------
+// Draw Commands
+//------------------------------------------------------------------------------
+//
+// Elements draw by emitting commands. The commands are submitted to raylib
+// right away, or recorded to a draw list while one is active. Recorded lists
+// are sorted to group the commands by shader and texture (fewer draw calls and
+// state changes), then submitted in one go.
+//
+// - Sorting never changes the result: a command only moves before earlier
+//   commands whose areas it does not overlap, and never across scissor or
+//   callback commands.
+// - `CguiDraw()` records the tree to a list every frame. Custom draw functions
+//   calling raylib directly must do so through a callback command
+//   (`CguiEmitCallback()`), else their drawing is not ordered with the rest.
+// - Lists are plain data, they can be recorded and inspected without a GPU.
+// - Boxes are not merged: each box is drawn with its own box shader values
+//   (uniforms), so every box is a draw call of its own. Consecutive boxes
+//   only save the shader changes.
+
+/// Draw command type.
+typedef enum CguiDrawCommandType {
+    CGUI_DRAW_COMMAND_TYPE_RECTANGLE,     ///< Solid rectangle.
+    CGUI_DRAW_COMMAND_TYPE_TEXTURE,       ///< Textured quad (textures, text glyphs).
+    CGUI_DRAW_COMMAND_TYPE_BOX,           ///< Styled rectangle (Box) using box shader.
+    CGUI_DRAW_COMMAND_TYPE_SCISSOR_BEGIN, ///< Begin scissor mode.
+    CGUI_DRAW_COMMAND_TYPE_SCISSOR_END,   ///< End scissor mode.
+    CGUI_DRAW_COMMAND_TYPE_CALLBACK,      ///< Call a node function.
+} CguiDrawCommandType;
+
+/// Draw command.
+typedef struct CguiDrawCommand {
+    int       type;   ///< Command type.
+    Rectangle bounds; ///< Area drawn to (conservative, includes anti-aliased edges, used for sorting), scissor area for scissor command.
+    Rectangle dest;   ///< Destination rectangle (rectangle, texture, box).
+
+    /// Data of the command type (only the member of the type is valid).
+    union {
+        /// Rectangle data.
+        struct {
+            Color color; ///< Color.
+        } rectangle;
+
+        /// Texture data.
+        struct {
+            Texture   texture;  ///< Texture.
+            Rectangle source;   ///< Source rectangle.
+            Vector2   origin;   ///< Origin of rotation.
+            float     rotation; ///< Rotation in degrees.
+            Color     tint;     ///< Tint.
+        } texture;
+
+        CguiBoxElementData box; ///< Box data.
+
+        /// Callback data.
+        struct {
+            CguiNodeFunction function; ///< Function to call.
+            CguiNode        *node;     ///< Node passed to the function.
+        } callback;
+    } data;
+} CguiDrawCommand;
+
+/// Draw list, recorded draw commands.
+typedef struct CguiDrawList {
+    CguiDrawCommand *commands;         ///< Recorded commands (in submission order once sorted).
+    int              commandsCount;    ///< Number of commands.
+    int              commandsCapacity; ///< Number of commands that can be recorded before reallocation.
+
+    CguiDrawCommand      *sorted;          ///< Internal: Sorted commands buffer.
+    struct CguiDrawBatch *batches;         ///< Internal: Batches of commands with the same state while sorting.
+    int                  *links;           ///< Internal: Next command index in the same batch while sorting.
+    int                   scratchCapacity; ///< Internal: Capacity of the sorting buffers.
+} CguiDrawList;
+
+CGAPI CguiDrawList *CguiCreateDrawList(void);                                           ///< Create an empty draw list.
+CGAPI void          CguiDeleteDrawList(CguiDrawList *list);                             ///< Delete a draw list.
+CGAPI void          CguiClearDrawList(CguiDrawList *list);                              ///< Clear the commands of a draw list (keeps capacity).
+CGAPI bool          CguiRecordDrawCommand(CguiDrawList *list, CguiDrawCommand command); ///< Record a command at the end of the list, returns true if recorded.
+CGAPI void          CguiBeginDrawList(CguiDrawList *list);                              ///< Record the emitted commands to the list instead of submitting them (until ended).
+CGAPI void          CguiEndDrawList(void);                                              ///< Stop recording the emitted commands.
+CGAPI void          CguiSortDrawList(CguiDrawList *list);                               ///< Sort the commands by state, preserving the drawing result.
+CGAPI void          CguiSubmitDrawList(CguiDrawList *list);                             ///< Submit the commands to raylib in order.
+CGAPI int           CguiGetDrawListStateChanges(CguiDrawList *list);                    ///< Get the number of shader or texture changes needed to submit the list.
+CGAPI int           CguiGetDrawListBatches(CguiDrawList *list);                         ///< Get the number of batches (draw calls) submitting the list takes, one for each box.
+CGAPI void          CguiSubmitDrawCommand(CguiDrawCommand command);                     ///< Submit a command to raylib right away.
+
+CGAPI void CguiEmitDrawCommand(CguiDrawCommand command);                                                                   ///< Record the command to the active draw list, or submit it right away if none.
+CGAPI void CguiEmitRectangle(Rectangle rec, Color color);                                                                  ///< Emit a solid rectangle.
+CGAPI void CguiEmitTexture(Texture texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); ///< Emit a textured quad (like `DrawTexturePro()`).
+CGAPI void CguiEmitTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint);                  ///< Emit a text glyph (like `DrawTextCodepoint()`).
+CGAPI void CguiEmitBox(Rectangle bounds, CguiBoxElementData box);                                                          ///< Emit a styled rectangle (Box).
+CGAPI void CguiEmitScissor(Rectangle area);                                                                                ///< Emit beginning scissor mode.
+CGAPI void CguiEmitScissorEnd(void);                                                                                       ///< Emit ending scissor mode.
+CGAPI void CguiEmitCallback(CguiNodeFunction function, CguiNode *node);                                                    ///< Emit calling a node function (e.g., for drawing with raylib directly).
+
+// Software rendering
+// Draw lists are rasterized on the CPU to an image, without a GPU or window
+// (e.g., for golden-image tests and benchmarks on CI). Boxes use the same
+// math as the box shader, rectangles and textures use raylib's blending.
+//
+// - Textures (including font textures) cannot be read back from the GPU,
+//   their pixels are registered to the renderer as images by texture id.
+//   Quads with unregistered textures are not drawn.
+// - Set the app size to the image size (`CguiSetAppSize()`) to transform and
+//   cull the nodes without a window.
+// - Callback commands draw with raylib directly, they are skipped.
+// - `CguiInit()` works without a window, the box shader and the theme fonts
+//   are not loaded then.
+// - Texts need a font with glyphs, the default font is not loaded without a
+//   window. Build the font on the CPU (`LoadFontData()` and
+//   `GenImageFontAtlas()`), set its texture id to any unused id and register
+//   the atlas image with it. Texts without a font with glyphs are not drawn.
+
+/// Software renderer.
+typedef struct CguiSoftwareRenderer {
+    Image image; ///< Rendered image (R8G8B8A8).
+
+    struct CguiSoftwareTexture *textures;         ///< Internal: Registered texture images.
+    int                         texturesCount;    ///< Internal: Number of registered texture images.
+    int                         texturesCapacity; ///< Internal: Number of texture images that can be registered before reallocation.
+    CguiDrawList               *list;             ///< Internal: Draw list to record nodes.
+} CguiSoftwareRenderer;
+
+CGAPI CguiSoftwareRenderer *CguiCreateSoftwareRenderer(int width, int height);                                    ///< Create a software renderer with a blank image of the size.
+CGAPI void                  CguiDeleteSoftwareRenderer(CguiSoftwareRenderer *renderer);                           ///< Delete a software renderer (registered images are not unloaded).
+CGAPI bool                  CguiSetSoftwareTexture(CguiSoftwareRenderer *renderer, Texture texture, Image image); ///< Register the image as pixels of the texture (not copied, must remain valid), returns true if registered.
+CGAPI void                  CguiClearSoftwareRenderer(CguiSoftwareRenderer *renderer, Color color);               ///< Clear the image with the color.
+CGAPI void                  CguiRenderDrawListSoftware(CguiSoftwareRenderer *renderer, CguiDrawList *list);       ///< Rasterize the commands of the list to the image in order.
+CGAPI void                  CguiRenderNodeSoftware(CguiSoftwareRenderer *renderer, CguiNode *node);               ///< Record drawing of the node (and its children) and rasterize it to the image.
+
 //------------------------------------------------------------------------------
 // Interpolation & Transitions
 //------------------------------------------------------------------------------
@@ -826,8 +1421,170 @@ CGAPI CguiTextElementData    CguiInterpTextElementData(CguiTextElementData a, Cg
 CGAPI CguiTextureElementData CguiInterpTextureElementData(CguiTextureElementData a, CguiTextureElementData b, float t); ///< Interpolate between two CguiTransformation.
 CGAPI CguiBoxElementData     CguiInterpBoxElementData(CguiBoxElementData a, CguiBoxElementData b, float t);             ///< Interpolate between two CguiTransformation.
 
+// Generated interpolators
+// `CG_DEFINE_INTERP()` defines an interpolator (matching `CguiInterpFunction`),
+// an equality function and a field table function for a struct from an
+// X-macro listing its fields, each as `X(KIND, name)`. The interpolator and
+// the equality function work in place through pointers, field by field,
+// without copying the struct (out may be a or b). The field table lists the
+// offset, size and kind of each field; batches and springs split the common
+// types into lanes with their tables, and user structs with the table given
+// along with the interpolator (see `CguiTransitInterp()`). Kinds of fields:
+//
+// - FLOAT, INT, VECTOR2, VECTOR3, VECTOR4: Interpolated.
+// - SIZE, SIZE2: Interpolated, not less than 0 (float, Vector2).
+// - RECTANGLE: Interpolated, size not less than 0.
+// - COLOR: Interpolated with t clamped to the range [0..1].
+// - TEXTURE, FONT: Switched at t = 0.5, compared by texture id.
+// - DISCRETE: Any other type, switched at t = 0.5, compared by bytes with
+//   memcmp(). Padding bytes are compared too, so structs with padding (e.g., a
+//   char followed by a float) may compare unequal while their members are
+//   equal; list the members of such structs as their own fields instead.
+//
+// Example for a user struct:
+//   #define MY_DATA_FIELDS(X) X(VECTOR2, offset) X(COLOR, tint) X(TEXTURE, icon)
+//   CG_DEFINE_INTERP(MyData, InterpMyDataP, IsMyDataEqualP, GetMyDataFields, MY_DATA_FIELDS)
+
+/// Kind of a field listed for a generated interpolator.
+typedef enum CguiInterpFieldKind {
+    CGUI_INTERP_FIELD_KIND_FLOAT,     ///< float.
+    CGUI_INTERP_FIELD_KIND_INT,       ///< int.
+    CGUI_INTERP_FIELD_KIND_SIZE,      ///< float, not less than 0.
+    CGUI_INTERP_FIELD_KIND_VECTOR2,   ///< Vector2.
+    CGUI_INTERP_FIELD_KIND_SIZE2,     ///< Vector2, not less than 0.
+    CGUI_INTERP_FIELD_KIND_VECTOR3,   ///< Vector3.
+    CGUI_INTERP_FIELD_KIND_VECTOR4,   ///< Vector4.
+    CGUI_INTERP_FIELD_KIND_RECTANGLE, ///< Rectangle, size not less than 0.
+    CGUI_INTERP_FIELD_KIND_COLOR,     ///< Color.
+    CGUI_INTERP_FIELD_KIND_TEXTURE,   ///< Texture (discrete).
+    CGUI_INTERP_FIELD_KIND_FONT,      ///< Font (discrete).
+    CGUI_INTERP_FIELD_KIND_DISCRETE,  ///< Any other type (discrete).
+    CGUI_INTERP_FIELD_KIND_MAX
+} CguiInterpFieldKind;
+
+/// Field listed for a generated interpolator.
+typedef struct CguiInterpField {
+    int offset; ///< Offset of the field in the struct.
+    int size;   ///< Size of the field in bytes.
+    int kind;   ///< Kind of the field (see CguiInterpFieldKind).
+} CguiInterpField;
+
+typedef const CguiInterpField *(*CguiInterpFieldsFunction)(int *count); ///< Function to get the field table of a generated interpolator.
+
+#define CG_INTERP_FIELD_FLOAT(from, to, t, tClamped, out)    (out) = (from) + ((to) - (from)) * (t)
+#define CG_INTERP_FIELD_INT(from, to, t, tClamped, out)      (out) = (int) ((from) + ((to) - (from)) * (t))
+#define CG_INTERP_FIELD_SIZE(from, to, t, tClamped, out)     (out) = fmaxf((from) + ((to) - (from)) * (t), 0.0f)
+#define CG_INTERP_FIELD_VECTOR2(from, to, t, tClamped, out)  CG_INTERP_FIELD_FLOAT((from).x, (to).x, t, tClamped, (out).x), CG_INTERP_FIELD_FLOAT((from).y, (to).y, t, tClamped, (out).y)
+#define CG_INTERP_FIELD_SIZE2(from, to, t, tClamped, out)    CG_INTERP_FIELD_SIZE((from).x, (to).x, t, tClamped, (out).x), CG_INTERP_FIELD_SIZE((from).y, (to).y, t, tClamped, (out).y)
+#define CG_INTERP_FIELD_VECTOR3(from, to, t, tClamped, out)  CG_INTERP_FIELD_VECTOR2(from, to, t, tClamped, out), CG_INTERP_FIELD_FLOAT((from).z, (to).z, t, tClamped, (out).z)
+#define CG_INTERP_FIELD_VECTOR4(from, to, t, tClamped, out)  CG_INTERP_FIELD_VECTOR3(from, to, t, tClamped, out), CG_INTERP_FIELD_FLOAT((from).w, (to).w, t, tClamped, (out).w)
+#define CG_INTERP_FIELD_DISCRETE(from, to, t, tClamped, out) (out) = (t) <= 0.5f ? (from) : (to)
+#define CG_INTERP_FIELD_TEXTURE                              CG_INTERP_FIELD_DISCRETE
+#define CG_INTERP_FIELD_FONT                                 CG_INTERP_FIELD_DISCRETE
+#define CG_INTERP_FIELD_RECTANGLE(from, to, t, tClamped, out)                   \
+    CG_INTERP_FIELD_FLOAT((from).x, (to).x, t, tClamped, (out).x),              \
+    CG_INTERP_FIELD_FLOAT((from).y, (to).y, t, tClamped, (out).y),              \
+    CG_INTERP_FIELD_SIZE((from).width, (to).width, t, tClamped, (out).width),   \
+    CG_INTERP_FIELD_SIZE((from).height, (to).height, t, tClamped, (out).height)
+#define CG_INTERP_FIELD_COLOR(from, to, t, tClamped, out)                    \
+    (out).r = (unsigned char) ((from).r + ((to).r - (from).r) * (tClamped)), \
+    (out).g = (unsigned char) ((from).g + ((to).g - (from).g) * (tClamped)), \
+    (out).b = (unsigned char) ((from).b + ((to).b - (from).b) * (tClamped)), \
+    (out).a = (unsigned char) ((from).a + ((to).a - (from).a) * (tClamped))
+
+#define CG_EQUAL_FIELD_FLOAT(lhs, rhs)     ((lhs) == (rhs))
+#define CG_EQUAL_FIELD_INT(lhs, rhs)       ((lhs) == (rhs))
+#define CG_EQUAL_FIELD_SIZE(lhs, rhs)      ((lhs) == (rhs))
+#define CG_EQUAL_FIELD_VECTOR2(lhs, rhs)   ((lhs).x == (rhs).x && (lhs).y == (rhs).y)
+#define CG_EQUAL_FIELD_SIZE2(lhs, rhs)     ((lhs).x == (rhs).x && (lhs).y == (rhs).y)
+#define CG_EQUAL_FIELD_VECTOR3(lhs, rhs)   ((lhs).x == (rhs).x && (lhs).y == (rhs).y && (lhs).z == (rhs).z)
+#define CG_EQUAL_FIELD_VECTOR4(lhs, rhs)   ((lhs).x == (rhs).x && (lhs).y == (rhs).y && (lhs).z == (rhs).z && (lhs).w == (rhs).w)
+#define CG_EQUAL_FIELD_RECTANGLE(lhs, rhs) ((lhs).x == (rhs).x && (lhs).y == (rhs).y && (lhs).width == (rhs).width && (lhs).height == (rhs).height)
+#define CG_EQUAL_FIELD_COLOR(lhs, rhs)     ((lhs).r == (rhs).r && (lhs).g == (rhs).g && (lhs).b == (rhs).b && (lhs).a == (rhs).a)
+#define CG_EQUAL_FIELD_TEXTURE(lhs, rhs)   ((lhs).id == (rhs).id)
+#define CG_EQUAL_FIELD_FONT(lhs, rhs)      ((lhs).texture.id == (rhs).texture.id)
+#define CG_EQUAL_FIELD_DISCRETE(lhs, rhs)  (memcmp(&(lhs), &(rhs), sizeof(lhs)) == 0)
+
+#define CG_INTERP_FIELD(kind, name) CG_INTERP_FIELD_##kind(a->name, b->name, t, tClamped, out->name);
+#define CG_EQUAL_FIELD(kind, name)  &&CG_EQUAL_FIELD_##kind(a->name, b->name)
+#define CG_TABLE_FIELD(kind, name)  { (int) offsetof(CgFieldsType, name), (int) sizeof(((CgFieldsType *) 0)->name), CGUI_INTERP_FIELD_KIND_##kind },
+
+// Declare the functions defined by `CG_DEFINE_INTERP()`
+#define CG_DECLARE_INTERP(type, interpName, equalName, fieldsName)    \
+    void interpName(const type *a, const type *b, float t, type *out); \
+    bool equalName(const type *a, const type *b);                      \
+    const CguiInterpField *fieldsName(int *count)
+
+// Define an interpolator, an equality function and a field table function for the fields of a struct
+#define CG_DEFINE_INTERP(type, interpName, equalName, fieldsName, FIELDS)   \
+    void interpName(const type *a, const type *b, float t, type *out)       \
+    {                                                                       \
+        if (!a || !b || !out)                                               \
+        {                                                                   \
+            return;                                                         \
+        }                                                                   \
+                                                                            \
+        float tClamped = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);           \
+        (void) tClamped;                                                    \
+                                                                            \
+        FIELDS(CG_INTERP_FIELD)                                             \
+    }                                                                       \
+                                                                            \
+    bool equalName(const type *a, const type *b)                           \
+    {                                                                       \
+        if (!a || !b)                                                       \
+        {                                                                   \
+            return a == b;                                                  \
+        }                                                                   \
+                                                                            \
+        return true FIELDS(CG_EQUAL_FIELD);                                 \
+    }                                                                       \
+                                                                            \
+    const CguiInterpField *fieldsName(int *count)                           \
+    {                                                                       \
+        typedef type CgFieldsType;                                          \
+        static const CguiInterpField fields[] = { FIELDS(CG_TABLE_FIELD) }; \
+                                                                            \
+        if (count) *count = (int) (sizeof(fields) / sizeof(fields[0]));     \
+        return fields;                                                      \
+    }
+
+// Interpolators for common types in place
+
+CGAPI void CguiInterpIntP(const int *a, const int *b, float t, int *out);                 ///< Interpolate between two int in place.
+CGAPI void CguiInterpFloatP(const float *a, const float *b, float t, float *out);         ///< Interpolate between two float in place.
+CGAPI void CguiInterpVector2P(const Vector2 *a, const Vector2 *b, float t, Vector2 *out); ///< Interpolate between two Vector2 in place.
+CGAPI void CguiInterpVector3P(const Vector3 *a, const Vector3 *b, float t, Vector3 *out); ///< Interpolate between two Vector3 in place.
+CGAPI void CguiInterpVector4P(const Vector4 *a, const Vector4 *b, float t, Vector4 *out); ///< Interpolate between two Vector4 in place.
+CGAPI void CguiInterpColorP(const Color *a, const Color *b, float t, Color *out);         ///< Interpolate between two Color in place.
+
+// Generated interpolators, equality functions and field tables for common types
+
+CGAPI void                   CguiInterpRectangleP(const Rectangle *a, const Rectangle *b, float t, Rectangle *out);                                                 ///< Interpolate between two Rectangle in place.
+CGAPI void                   CguiInterpTransformationP(const CguiTransformation *a, const CguiTransformation *b, float t, CguiTransformation *out);                 ///< Interpolate between two CguiTransformation in place.
+CGAPI void                   CguiInterpTextElementDataP(const CguiTextElementData *a, const CguiTextElementData *b, float t, CguiTextElementData *out);             ///< Interpolate between two CguiTextElementData in place.
+CGAPI void                   CguiInterpTextureElementDataP(const CguiTextureElementData *a, const CguiTextureElementData *b, float t, CguiTextureElementData *out); ///< Interpolate between two CguiTextureElementData in place.
+CGAPI void                   CguiInterpBoxElementDataP(const CguiBoxElementData *a, const CguiBoxElementData *b, float t, CguiBoxElementData *out);                 ///< Interpolate between two CguiBoxElementData in place.
+CGAPI bool                   CguiIsRectangleEqualP(const Rectangle *a, const Rectangle *b);                                                                         ///< Check if two Rectangle are equal in place.
+CGAPI bool                   CguiIsTransformationEqualP(const CguiTransformation *a, const CguiTransformation *b);                                                  ///< Check if two CguiTransformation are equal in place.
+CGAPI bool                   CguiIsTextElementDataEqualP(const CguiTextElementData *a, const CguiTextElementData *b);                                               ///< Check if two CguiTextElementData are equal in place.
+CGAPI bool                   CguiIsTextureElementDataEqualP(const CguiTextureElementData *a, const CguiTextureElementData *b);                                      ///< Check if two CguiTextureElementData are equal in place.
+CGAPI bool                   CguiIsBoxElementDataEqualP(const CguiBoxElementData *a, const CguiBoxElementData *b);                                                  ///< Check if two CguiBoxElementData are equal in place.
+CGAPI const CguiInterpField *CguiGetRectangleFields(int *count);                                                                                                    ///< Get the field table of Rectangle.
+CGAPI const CguiInterpField *CguiGetTransformationFields(int *count);                                                                                               ///< Get the field table of CguiTransformation.
+CGAPI const CguiInterpField *CguiGetTextElementDataFields(int *count);                                                                                              ///< Get the field table of CguiTextElementData.
+CGAPI const CguiInterpField *CguiGetTextureElementDataFields(int *count);                                                                                           ///< Get the field table of CguiTextureElementData.
+CGAPI const CguiInterpField *CguiGetBoxElementDataFields(int *count);                                                                                               ///< Get the field table of CguiBoxElementData.
+
 // Transition
 
+/// Kind of a transition.
+typedef enum CguiTransitionKind {
+    CGUI_TRANSITION_KIND_EASE,   ///< Interpolates over the duration with the easing.
+    CGUI_TRANSITION_KIND_SPRING, ///< Moves towards the target with a critically damped spring until at rest.
+    CGUI_TRANSITION_KIND_MAX
+} CguiTransitionKind;
+
 struct CguiTransition;
 typedef struct CguiTransition CguiTransition;
 
@@ -837,8 +1594,10 @@ struct CguiTransition {
     const void *to;     ///< Ending value to end interpolation.
     void       *result; ///< Value to update during interpolation.
 
-    CguiInterpFunction interp; ///< Interpolation function to obtain intermediate value.
-    CguiEasingFunction easing; ///< Easing function to customize the interpolation curve.
+    CguiInterpFunction       interp;      ///< Interpolation function to obtain intermediate value.
+    CguiInterpFieldsFunction fields;      ///< Field table function of a generated interpolator to batch and spring the value (NULL for the common types).
+    CguiEasingFunction       easing;      ///< Easing function to customize the interpolation curve.
+    const CguiEasingTable   *easingTable; ///< Table to evaluate easing from instead of the easing function (not owned, NULL to call easing).
 
     float delayBefore; ///< Delay before interpolation of this transition.
     float duration;    ///< Duration for interpolating this transition.
@@ -850,17 +1609,25 @@ struct CguiTransition {
 
     CguiTransition *prev; ///< Previous transition in the chain.
     CguiTransition *next; ///< Next transition in the chain.
+
+    struct CguiTransitionChain *autoChain; ///< Internal: Chain created to register this transition (NULL if not registered).
+
+    int    kind;             ///< Kind of the transition (see CguiTransitionKind).
+    float *springState;      ///< Internal: Values then velocities of the lanes moved by the spring (auto-freed).
+    int    springLanesCount; ///< Internal: Number of lanes moved by the spring.
 };
 
 /// Transition chain.
 typedef struct CguiTransitionChain {
-    CguiTransition *first;         ///< First transition in the chain (auto-freed).
-    CguiTransition *last;          ///< Last transition in the chain (auto-freed).
-    bool            paused;        ///< Whether to pause transition from continuing further.
-    CguiTransition *active;        ///< Current active transition.
-    int             activeRepeats; ///< Number of repeats made in the active transition.
-    float           activeTime;    ///< Number of seconds passed since the beginning of the active transition.
-    bool            finished;      ///< Whether all the transitions in the chain has ended.
+    CguiTransition *first;          ///< First transition in the chain (auto-freed).
+    CguiTransition *last;           ///< Last transition in the chain (auto-freed).
+    bool            paused;         ///< Whether to pause transition from continuing further.
+    CguiTransition *active;         ///< Current active transition.
+    int             activeRepeats;  ///< Number of repeats made in the active transition.
+    float           activeTime;     ///< Number of seconds passed since the beginning of the active transition.
+    bool            finished;       ///< Whether all the transitions in the chain has ended.
+    int             scheduledSlot;  ///< Internal: Index of the chain in the scheduled chains plus one (0 if not scheduled).
+    int             registeredSlot; ///< Internal: Slot of the chain in the auto transition registry plus one (0 if not registered).
 } CguiTransitionChain;
 
 CGAPI CguiTransition *CguiCreateTransition(void);                                                                                                                                                                                         ///< Create a transition.
@@ -871,6 +1638,7 @@ CGAPI void            CguiDeleteTransition(CguiTransition *transition);
 CGAPI CguiTransitionChain *CguiCreateTransitionChain(void);                                                                     ///< Create a new transition chain starting at given time.
 CGAPI void                 CguiDeleteTransitionChain(CguiTransitionChain *chain);                                               ///< Delete the transition chain and all transitions.
 CGAPI void                 CguiDeleteTransitionChainSelf(CguiTransitionChain *chain);                                           ///< Delete the transition chain itself (not attached transitions).
+CGAPI CguiTransitionChain *CguiCloneTransitionChain(CguiTransitionChain *chain, const void *fromBase, void *toBase, int size);  ///< Clone the chain with its transitions and progress, values within the from memory are pointed at the same offsets in the to memory.
 CGAPI bool                 CguiInsertTransition(CguiTransitionChain *chain, CguiTransition *transition);                        ///< Insert a transition at the end.
 CGAPI bool                 CguiInsertTransitionAt(CguiTransitionChain *chain, CguiTransition *transition, int transitionIndex); ///< Insert a transition at specified index.
 CGAPI bool                 CguiRemoveTransition(CguiTransitionChain *chain, CguiTransition *transition);                        ///< Remove a specific transition.
@@ -883,13 +1651,108 @@ CGAPI int                  CguiFindTransition(CguiTransitionChain *chain, CguiTr
 CGAPI CguiTransition      *CguiGetTransitionAt(CguiTransitionChain *chain, int transitionIndex);                                ///< Get transition at specified index.
 CGAPI int                  CguiGetTransitionsCount(CguiTransitionChain *chain);                                                 ///< Get the number of transitions in the chain.
 
-CGAPI void CguiUpdateTransition(CguiTransition *transition, float elapsedTime); ///< Update transition.
-CGAPI void CguiUpdateTransitionChain(CguiTransitionChain *chain);               ///< Update transition chain.
-CGAPI void CguiRegisterAutoTransition(CguiTransition *transition);              ///< Register to automatically update and delete transition.
-CGAPI void CguiRegisterAutoTransitionChain(CguiTransitionChain *chain);         ///< Register to automatically update and delete transition chain.
-CGAPI void CguiUnregisterAutoTransition(CguiTransition *transition);            ///< Unregister to automatically updating and deleting transition.
-CGAPI void CguiUnregisterAutoTransitionChain(CguiTransitionChain *chain);       ///< Unregister to automatically updating and deleting transition chain.
-CGAPI void CguiUpdateRegisteredTransitions(void);                               ///< Update all registered transitions.
+CGAPI void CguiUpdateTransition(CguiTransition *transition, float elapsedTime);     ///< Update transition (not springs, see spring transitions).
+CGAPI void CguiUpdateTransitionChain(CguiTransitionChain *chain);                   ///< Update transition chain by a step of the current update (see transition clock).
+CGAPI void CguiAdvanceTransitionChain(CguiTransitionChain *chain, float deltaTime); ///< Update transition chain by the time (in seconds).
+
+// Transition pool
+// Transitions and chains are allocated from a shared pool, in pages of
+// `CGUI_TRANSITION_POOL_PAGE_SIZE`, and deleting them returns them to the pool.
+//
+// - Transitions created right after their chain are adjacent to it in memory.
+// - Pages are kept for reuse until the pool is trimmed (`CguiClose()` trims it).
+// - Transitions and chains must be created with the functions above.
+
+CGAPI int  CguiGetPooledTransitionsCount(void); ///< Get the number of transitions and chains in use from the pool.
+CGAPI bool CguiTrimTransitionPool(void);        ///< Free the pool pages, returns false if any transitions or chains are in use.
+
+// Auto transitions
+// Registered chains are updated once per `CguiUpdate()` and deleted once
+// finished (fire-and-forget). Registering and unregistering take constant
+// time, and the registered chains are stored contiguously for updating.
+//
+// - A handle refers to a registered chain, resolving it returns NULL once the
+//   chain is finished or unregistered (its slot is reused with a new generation).
+// - Deleting a registered chain unregisters it.
+
+/// Generational handle of a registered chain. Zero-initialized handle is never valid.
+typedef struct CguiTransitionHandle {
+    unsigned int index;      ///< Slot index in the registry.
+    unsigned int generation; ///< Generation of the slot at the time the chain was registered.
+} CguiTransitionHandle;
+
+CGAPI CguiTransitionHandle CguiRegisterAutoTransition(CguiTransition *transition);        ///< Register to automatically update and delete transition, returns a zero handle on failure.
+CGAPI CguiTransitionHandle CguiRegisterAutoTransitionChain(CguiTransitionChain *chain);   ///< Register to automatically update and delete transition chain, returns a zero handle on failure.
+CGAPI void                 CguiUnregisterAutoTransition(CguiTransition *transition);      ///< Unregister to automatically updating and deleting transition.
+CGAPI void                 CguiUnregisterAutoTransitionChain(CguiTransitionChain *chain); ///< Unregister to automatically updating and deleting transition chain.
+CGAPI CguiTransitionChain *CguiResolveTransitionHandle(CguiTransitionHandle handle);      ///< Get the registered chain of a handle, returns NULL if finished or unregistered.
+CGAPI int                  CguiGetRegisteredTransitionsCount(void);                       ///< Get the number of registered chains.
+CGAPI void                 CguiUpdateRegisteredTransitions(void);                         ///< Update all registered transitions, deleting the finished ones.
+CGAPI void                 CguiClearRegisteredTransitions(void);                          ///< Delete all registered transitions.
+
+// Scheduled transitions
+// Running chains are scheduled to be updated along with the other running
+// chains once per `CguiUpdate()`, finished chains are unscheduled. The cost of
+// updating transitions depends on the number of running chains only.
+//
+// - Scheduled chains are not owned, deleting a chain unschedules it.
+// - Components restart and schedule their chains when their state changes.
+
+CGAPI bool CguiScheduleTransitionChain(CguiTransitionChain *chain);   ///< Schedule the chain to be updated until finished, returns true if scheduled.
+CGAPI void CguiUnscheduleTransitionChain(CguiTransitionChain *chain); ///< Stop updating the scheduled chain.
+CGAPI void CguiRestartTransitionChain(CguiTransitionChain *chain);    ///< Restart the chain from the first transition and schedule it.
+CGAPI void CguiRetargetTransitionChain(CguiTransitionChain *chain);   ///< Continue the chain towards the changed target and schedule it (restarts if not a spring).
+CGAPI void CguiUpdateScheduledTransitions(void);                      ///< Update all scheduled chains, unscheduling the finished chains.
+CGAPI int  CguiGetScheduledTransitionsCount(void);                    ///< Get the number of scheduled chains.
+
+// Spring transitions
+// A spring transition moves each float of the value towards the target with a
+// critically damped spring, instead of easing over a fixed duration. The
+// target is read as the spring steps, so changing the target mid-transition
+// keeps the current value and velocity (retargeting), without restarting.
+//
+// - Duration is the time to come within 1% of the target from rest.
+// - Delays, repeats and reversing do not apply to springs.
+// - Discrete fields (e.g., textures) take the target right away.
+// - Supports the common types except int, and generated interpolators given
+//   their field table (see `CguiSpringInterp()`).
+
+CGAPI CguiTransition *CguiCreateSpringTransition(const void *from, const void *to, void *result, CguiInterpFunction interp, float duration); ///< Create a spring transition starting at rest from the value.
+CGAPI void            CguiResetSpringTransition(CguiTransition *transition);                                                               ///< Put the spring at rest at its starting value.
+CGAPI bool            CguiStepSpringTransition(CguiTransition *transition, float deltaTime);                                               ///< Step the spring by the time, returns true once at rest at the target.
+
+// Batch interpolation
+// While a batch is open, transitions of the common types (except int) are
+// split into float lanes instead of calling their interpolator, and all the
+// lanes are interpolated in one SIMD sweep when the batch ends. `CguiUpdate()`
+// updates the registered and scheduled transitions in one batch.
+//
+// - Interpolated values are stored when the outermost batch ends.
+// - Transitions of generated interpolators are split with their field table
+//   (see `CguiTransitInterp()`), other interpolators are called right away.
+
+CGAPI void CguiInterpFloatBatch(const float *a, const float *b, const float *t, float *out, int count); ///< Interpolate arrays of floats (out may be a).
+CGAPI void CguiBeginTransitionBatch(void);                                                              ///< Begin deferring interpolation of updated transitions (may be nested).
+CGAPI void CguiEndTransitionBatch(void);                                                                ///< End the batch, interpolating and storing the deferred transitions.
+
+// Transition clock
+// Chains advance by the time passed since the previous update, read once per
+// `CguiUpdate()` from the time source (raylib's `GetTime()` by default).
+//
+// - Injecting a time source makes the animations reproducible (e.g., tests).
+// - With a fixed step, the passed time is accumulated and chains advance in
+//   whole steps only, one step at a time, the leftover time is kept for the
+//   next update. At most `CGUI_TRANSITION_STEPS_MAX` steps are taken in an
+//   update, the time of the steps over it is dropped.
+
+typedef double (*CguiTimeFunction)(void); ///< Function to get the current time in seconds.
+
+CGAPI void  CguiSetTransitionTimeFunction(CguiTimeFunction function); ///< Set the time source of the transition clock (NULL for `GetTime()`), restarts the clock.
+CGAPI void  CguiSetTransitionFixedStep(float step);                   ///< Set the fixed step of the transition clock in seconds (0 to advance by the passed time).
+CGAPI void  CguiTickTransitionClock(void);                            ///< Advance the transition clock by the time passed since the last tick (first tick only starts the clock).
+CGAPI void  CguiResetTransitionClock(void);                           ///< Restart the transition clock, the next tick does not advance.
+CGAPI float CguiGetTransitionDeltaTime(void);                         ///< Get the time transition chains advance by in the current update (all the steps).
+CGAPI int   CguiGetTransitionStepsCount(void);                        ///< Get the number of steps transition chains advance in the current update (1 without a fixed step).
 
 // Helpers to create transition for common types
 
@@ -905,11 +1768,33 @@ CGAPI CguiTransition *CguiTransitTextElementData(const CguiTextElementData *a, c
 CGAPI CguiTransition *CguiTransitTextureElementData(const CguiTextureElementData *a, const CguiTextureElementData *b, CguiTextureElementData *result, CguiEasingFunction easing, float duration);
 CGAPI CguiTransition *CguiTransitBoxElementData(const CguiBoxElementData *a, const CguiBoxElementData *b, CguiBoxElementData *result, CguiEasingFunction easing, float duration);
 
+// Helpers to create spring transition for common types
+
+CGAPI CguiTransition *CguiSpringFloat(const float *a, const float *b, float *result, float duration);
+CGAPI CguiTransition *CguiSpringVector2(const Vector2 *a, const Vector2 *b, Vector2 *result, float duration);
+CGAPI CguiTransition *CguiSpringVector3(const Vector3 *a, const Vector3 *b, Vector3 *result, float duration);
+CGAPI CguiTransition *CguiSpringVector4(const Vector4 *a, const Vector4 *b, Vector4 *result, float duration);
+CGAPI CguiTransition *CguiSpringColor(const Color *a, const Color *b, Color *result, float duration);
+CGAPI CguiTransition *CguiSpringRectangle(const Rectangle *a, const Rectangle *b, Rectangle *result, float duration);
+CGAPI CguiTransition *CguiSpringTransformation(const CguiTransformation *a, const CguiTransformation *b, CguiTransformation *result, float duration);
+CGAPI CguiTransition *CguiSpringTextElementData(const CguiTextElementData *a, const CguiTextElementData *b, CguiTextElementData *result, float duration);
+CGAPI CguiTransition *CguiSpringTextureElementData(const CguiTextureElementData *a, const CguiTextureElementData *b, CguiTextureElementData *result, float duration);
+CGAPI CguiTransition *CguiSpringBoxElementData(const CguiBoxElementData *a, const CguiBoxElementData *b, CguiBoxElementData *result, float duration);
+
+// Helpers to create transition for generated interpolators (see `CG_DEFINE_INTERP()`)
+
+CGAPI CguiTransition *CguiTransitInterp(const void *a, const void *b, void *result, CguiInterpFunction interp, CguiInterpFieldsFunction fields, CguiEasingFunction easing, float duration); ///< Create a transition batched with the field table.
+CGAPI CguiTransition *CguiSpringInterp(const void *a, const void *b, void *result, CguiInterpFunction interp, CguiInterpFieldsFunction fields, float duration);                              ///< Create a spring transition moving the fields of the field table.
+
 //------------------------------------------------------------------------------
 // GUI Component Nodes
 //------------------------------------------------------------------------------
 //
 // GUI components are composition of GUI elements and other components.
+//
+// - Components transition to their data when their state changes or their
+//   data is resynced from the theme. After editing the data of a component in
+//   place, increment its `version` for the component to transition to it.
 
 /// Common override field selector to override fields during template syncing.
 typedef enum CguiCommonOverrideField {
@@ -958,6 +1843,8 @@ typedef struct CguiRootData {
     Color              backgroundColor;    ///< Rectangle fill that will act as a background color.
     float              transitionDuration; ///< Transition duration.
     CguiEasingFunction transitionEasing;   ///< Transition easing function.
+
+    int version; ///< Increment after editing the data in place, for the instances to transition to it.
 } CguiRootData;
 
 /// Root node instance-specific data.
@@ -966,16 +1853,21 @@ typedef struct CguiRootInstanceData {
     Color                targetBackgroundColor;        ///< Target background color to transition towards.
     Color                transitioningBackgroundColor; ///< Transitioning background color which will be used to draw.
     CguiTransitionChain *transitionChain;              ///< Transition for background color.
+    const Color         *targetSource;                 ///< Internal: Color in the root data the target was copied from.
+    int                  targetVersion;                ///< Internal: Version of the root data the target was copied at.
 
     // Overriding fields
 
     CguiCommonOverrides overrides; ///< Common fields that can be overriden per instances.
 } CguiRootInstanceData;
 
-CGAPI CguiNode *CguiCreateRoot(void);              ///< Helper to create a root node.
-CGAPI void      CguiPreUpdateRoot(CguiNode *node); ///< Pre-update function (attached) for root node.
-CGAPI void      CguiPreDrawRoot(CguiNode *node);   ///< Pre-draw function (attached) for root node.
-CGAPI void      CguiOverrideRoot(CguiNode *node);  ///< Override function (attached) for root node.
+CGAPI CguiNode *CguiCreateRoot(void);                                   ///< Helper to create a root node.
+CGAPI void      CguiPreUpdateRoot(CguiNode *node);                      ///< Pre-update function (attached) for root node.
+CGAPI void      CguiPreDrawRoot(CguiNode *node);                        ///< Pre-draw function (attached) for root node.
+CGAPI Rectangle CguiGetRootOpaqueBounds(CguiNode *node);                ///< Opaque bounds function (attached) for root node.
+CGAPI void      CguiOverrideRoot(CguiNode *node);                       ///< Override function (attached) for root node.
+CGAPI void      CguiDeleteRootData(CguiNode *node);                     ///< Delete function (attached) for root node.
+CGAPI bool      CguiCopyRootData(CguiNode *fromNode, CguiNode *toNode); ///< Copy function (attached) for root node.
 
 /// Composition or child indices of layer node.
 typedef enum CguiLayerComposition {
@@ -997,14 +1889,19 @@ typedef struct CguiLayerData {
     CguiBoxElementData boxDatas[CGUI_LAYER_TYPE_MAX]; ///< Box element data of layer container of different types.
     float              transitionDuration;            ///< Transition duration.
     CguiEasingFunction transitionEasing;              ///< Transition easing function.
+
+    int version; ///< Increment after editing the data in place, for the instances to transition to it.
 } CguiLayerData;
 
 /// Layer container node instance-specific data.
 typedef struct CguiLayerInstanceData {
-    CguiBoxElementData   currentBoxData;       ///< Current box data before the transition.
-    CguiBoxElementData   targetBoxData;        ///< Target box data to transition towards.
-    CguiBoxElementData   transitioningBoxData; ///< Transitioning box data which will be used to draw.
-    CguiTransitionChain *transitionChain;      ///< Transition for box data.
+    CguiBoxElementData        currentBoxData;       ///< Current box data before the transition.
+    CguiBoxElementData        targetBoxData;        ///< Target box data to transition towards.
+    CguiBoxElementData        transitioningBoxData; ///< Transitioning box data which will be used to draw.
+    CguiTransitionChain      *transitionChain;      ///< Transition for box data.
+    const CguiBoxElementData *targetSource;         ///< Internal: Box data in the layer data the target was copied from.
+    int                       targetVersion;        ///< Internal: Version of the layer data the target was copied at.
+    bool                      targetApplied;        ///< Internal: Whether the box element has the data of the finished transition.
 
     int type; ///< Layer type.
 
@@ -1016,6 +1913,8 @@ typedef struct CguiLayerInstanceData {
 CGAPI CguiNode *CguiCreateLayer(CguiTransformation transformation, int type); ///< Helper to create a layer node.
 CGAPI void      CguiPreUpdateLayer(CguiNode *node);                           ///< Pre-update function (attached) for layer node.
 CGAPI void      CguiOverrideLayer(CguiNode *node);                            ///< Override function (attached) for layer node.
+CGAPI void      CguiDeleteLayerData(CguiNode *node);                          ///< Delete function (attached) for layer node.
+CGAPI bool      CguiCopyLayerData(CguiNode *fromNode, CguiNode *toNode);      ///< Copy function (attached) for layer node.
 
 /// Composition or child indices of label node.
 typedef enum CguiLabelComposition {
@@ -1038,14 +1937,19 @@ typedef struct CguiLabelData {
     CguiTextElementData disabledTextDatas[CGUI_LABEL_TYPE_MAX]; ///< Text element data for disabled label for each type.
     float               transitionDuration;                     ///< Transition duration.
     CguiEasingFunction  transitionEasing;                       ///< Transition easing function.
+
+    int version; ///< Increment after editing the data in place, for the instances to transition to it.
 } CguiLabelData;
 
 /// Label component instance-specific data.
 typedef struct CguiLabelInstanceData {
-    CguiTextElementData  currentTextData;       ///< Current text data before the transition.
-    CguiTextElementData  targetTextData;        ///< Target text data to transition towards.
-    CguiTextElementData  transitioningTextData; ///< Transitioning text data which will be used to draw.
-    CguiTransitionChain *transitionChain;       ///< Transition for box data.
+    CguiTextElementData        currentTextData;       ///< Current text data before the transition.
+    CguiTextElementData        targetTextData;        ///< Target text data to transition towards.
+    CguiTextElementData        transitioningTextData; ///< Transitioning text data which will be used to draw.
+    CguiTransitionChain       *transitionChain;       ///< Transition for box data.
+    const CguiTextElementData *targetSource;          ///< Internal: Text data in the label data the target was copied from.
+    int                        targetVersion;         ///< Internal: Version of the label data the target was copied at.
+    bool                       targetApplied;         ///< Internal: Whether the text element has the data of the finished transition.
 
     const char *text;     ///< Label text.
     int         type;     ///< Label type.
@@ -1061,6 +1965,8 @@ typedef struct CguiLabelInstanceData {
 CGAPI CguiNode *CguiCreateLabel(CguiTransformation transformation, const char *text, int type, bool disabled, int xJustify, int yJustify); ///< Helper to create a label node.
 CGAPI void      CguiPreUpdateLabel(CguiNode *node);                                                                                        ///< Pre-update function (attached) for label node.
 CGAPI void      CguiOverrideLabel(CguiNode *node);                                                                                         ///< Override function (attached) for label node.
+CGAPI void      CguiDeleteLabelData(CguiNode *node);                                                                                       ///< Delete function (attached) for label node.
+CGAPI bool      CguiCopyLabelData(CguiNode *fromNode, CguiNode *toNode);                                                                   ///< Copy function (attached) for label node.
 
 typedef void (*CguiButtonPressCallback)(CguiNode *button); ///< Callback for when button is pressed.
 
@@ -1091,14 +1997,20 @@ typedef struct CguiButtonData {
     CguiBoxElementData disabledBoxDatas[CGUI_BUTTON_TYPE_MAX]; ///< Box element data for button of different types when disabled.
     float              transitionDuration;                     ///< Transition duration.
     CguiEasingFunction transitionEasing;                       ///< Transition easing function.
+    bool               transitionSpring;                       ///< Whether to transition with a spring, which keeps its motion when the state changes (easing is not used).
+
+    int version; ///< Increment after editing the data in place, for the instances to transition to it.
 } CguiButtonData;
 
 /// Button component instance-specific data.
 typedef struct CguiButtonInstanceData {
-    CguiBoxElementData   currentBoxData;       ///< Current box data before the transition.
-    CguiBoxElementData   targetBoxData;        ///< Target box data to transition towards.
-    CguiBoxElementData   transitioningBoxData; ///< Transitioning box data which will be used to draw.
-    CguiTransitionChain *transitionChain;      ///< Transition for box data.
+    CguiBoxElementData        currentBoxData;       ///< Current box data before the transition.
+    CguiBoxElementData        targetBoxData;        ///< Target box data to transition towards.
+    CguiBoxElementData        transitioningBoxData; ///< Transitioning box data which will be used to draw.
+    CguiTransitionChain      *transitionChain;      ///< Transition for box data.
+    const CguiBoxElementData *targetSource;         ///< Internal: Box data in the button data the target was copied from.
+    int                       targetVersion;        ///< Internal: Version of the button data the target was copied at.
+    bool                      targetApplied;        ///< Internal: Whether the box element has the data of the finished transition.
 
     int                     mouseButton;   ///< Mouse button to detect press (default: MOUSE_BUTTON_LEFT).
     int                     type;          ///< Button type.
@@ -1119,6 +2031,8 @@ typedef struct CguiButtonInstanceData {
 CGAPI CguiNode *CguiCreateButton(CguiTransformation transformation, int type, CguiButtonPressCallback pressCallback, bool disabled); ///< Helper to create a button node.
 CGAPI void      CguiPreUpdateButton(CguiNode *node);                                                                                 ///< Pre-update function (attached) for the button node.
 CGAPI void      CguiOverrideButton(CguiNode *node);                                                                                  ///< Override function (attached) for the button node.
+CGAPI void      CguiDeleteButtonData(CguiNode *node);                                                                                ///< Delete function (attached) for the button node.
+CGAPI bool      CguiCopyButtonData(CguiNode *fromNode, CguiNode *toNode);                                                            ///< Copy function (attached) for the button node.
 CGAPI bool      CguiHandleButtonEvents(CguiNode *node, CguiEvent *event);                                                            ///< Event handler function (attached) for the button node.
 
 typedef void (*CguiTogglePressCallback)(CguiNode *toggle, bool active); ///< Callback for when toggle is pressed.
@@ -1142,14 +2056,20 @@ typedef struct CguiToggleData {
     CguiBoxElementData activeDisabledBoxData; ///< Box element data for toggle when active and disabled.
     float              transitionDuration;    ///< Transition duration.
     CguiEasingFunction transitionEasing;      ///< Transition easing function.
+    bool               transitionSpring;      ///< Whether to transition with a spring, which keeps its motion when the state changes (easing is not used).
+
+    int version; ///< Increment after editing the data in place, for the instances to transition to it.
 } CguiToggleData;
 
 /// Toggle component instance-specific data.
 typedef struct CguiToggleInstanceData {
-    CguiBoxElementData   currentBoxData;       ///< Current box data before the transition.
-    CguiBoxElementData   targetBoxData;        ///< Target box data to transition towards.
-    CguiBoxElementData   transitioningBoxData; ///< Transitioning box data which will be used to draw.
-    CguiTransitionChain *transitionChain;      ///< Transition for box data.
+    CguiBoxElementData        currentBoxData;       ///< Current box data before the transition.
+    CguiBoxElementData        targetBoxData;        ///< Target box data to transition towards.
+    CguiBoxElementData        transitioningBoxData; ///< Transitioning box data which will be used to draw.
+    CguiTransitionChain      *transitionChain;      ///< Transition for box data.
+    const CguiBoxElementData *targetSource;         ///< Internal: Box data in the toggle data the target was copied from.
+    int                       targetVersion;        ///< Internal: Version of the toggle data the target was copied at.
+    bool                      targetApplied;        ///< Internal: Whether the box element has the data of the finished transition.
 
     int                     mouseToggle;   ///< Mouse toggle to detect press (default: MOUSE_TOGGLE_LEFT).
     CguiTogglePressCallback pressCallback; ///< Callback called when toggle is pressed.
@@ -1169,6 +2089,8 @@ typedef struct CguiToggleInstanceData {
 CGAPI CguiNode *CguiCreateToggle(CguiTransformation transformation, bool active, CguiTogglePressCallback pressCallback, bool disabled); ///< Helper to create a toggle node.
 CGAPI void      CguiPreUpdateToggle(CguiNode *node);                                                                                    ///< Pre-update function (attached) for the toggle node.
 CGAPI void      CguiOverrideToggle(CguiNode *node);                                                                                     ///< Override function (attached) for the toggle node.
+CGAPI void      CguiDeleteToggleData(CguiNode *node);                                                                                   ///< Delete function (attached) for the toggle node.
+CGAPI bool      CguiCopyToggleData(CguiNode *fromNode, CguiNode *toNode);                                                               ///< Copy function (attached) for the toggle node.
 CGAPI bool      CguiHandleToggleEvents(CguiNode *node, CguiEvent *event);                                                               ///< Event handler function (attached) for the toggle node.
 
 //------------------------------------------------------------------------------
@@ -1289,6 +2211,7 @@ typedef struct CguiCrystallineThemeData {
 
     float              componentTransitionDuration; ///< Duration for transition of component's states.
     CguiEasingFunction componentTransitionEasing;   ///< Easing function for transition.
+    bool               componentTransitionSpring;   ///< Whether interactive components (buttons, toggles) transition with springs (off in the Crystalline themes).
 } CguiCrystallineThemeData;
 
 CGAPI CguiTheme *CguiCreateCrystallineThemeDark(void);                              ///< Helper to create the Crystalline theme (Dark version).
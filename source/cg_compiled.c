@@ -0,0 +1,342 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This source file contains implementations for compiled (flattened) trees.
+///
+/// This project is licensed under the terms of MIT license.
+
+#include <string.h>
+
+#include "crystalgui/crystalgui.h"
+#include "raylib.h"
+
+extern unsigned int cguiTreeVersion;
+
+CguiCompiledTree *CguiCreateCompiledTree(CguiNode *root)
+{
+    if (!root)
+    {
+        return NULL;
+    }
+
+    CguiCompiledTree *tree = CG_MALLOC_NULL(sizeof(CguiCompiledTree));
+    if (!tree)
+    {
+        return NULL;
+    }
+
+    tree->root = root;
+
+    return tree;
+}
+
+void CguiDeleteCompiledTree(CguiCompiledTree *tree)
+{
+    if (!tree)
+    {
+        return;
+    }
+
+    CG_FREE_NULL(tree->nodes);
+    CG_FREE_NULL(tree->visibleNodes);
+    CG_FREE_NULL(tree);
+}
+
+static bool CguiAppendCompiledNode(CguiCompiledTree *tree, CguiNode *node, int parent)
+{
+    // Resize capacity if full
+    if (tree->nodesCount == tree->nodesCapacity)
+    {
+        int               newCapacity = (tree->nodesCapacity == 0) ? 64 : (tree->nodesCapacity * 2);
+        CguiCompiledNode *newNodes    = CG_REALLOC(tree->nodes, sizeof(CguiCompiledNode) * newCapacity);
+        if (!newNodes)
+        {
+            return false;
+        }
+
+        tree->nodes = newNodes;
+
+        // Every record may be drawn, visible nodes never exceed the records
+        CguiNode **newVisibleNodes = CG_REALLOC(tree->visibleNodes, sizeof(CguiNode *) * newCapacity);
+        if (!newVisibleNodes)
+        {
+            return false;
+        }
+
+        tree->visibleNodes  = newVisibleNodes;
+        tree->nodesCapacity = newCapacity;
+    }
+
+    CguiCompiledNode *record = &tree->nodes[tree->nodesCount];
+
+    record->node         = node;
+    record->parent       = parent;
+    record->clipParent   = parent == -1 ? -1 : (tree->nodes[parent].node->clipChildren ? parent : tree->nodes[parent].clipParent);
+    record->subtreeSize  = 0;
+    record->enabled      = node->enabled && (parent == -1 || tree->nodes[parent].enabled);
+    record->rebound      = false;
+    record->culled       = false;
+    record->cullChildren = false;
+    record->clip         = (Rectangle) { 0 };
+    record->transform    = node->transform;
+    record->drawPre      = node->drawPre;
+    record->drawPost     = node->drawPost;
+
+    tree->nodesCount++;
+
+    return true;
+}
+
+bool CguiCompileTree(CguiCompiledTree *tree)
+{
+    if (!tree || !tree->root)
+    {
+        return false;
+    }
+
+    // Optimization: Structure unchanged since the last build
+    if (tree->compiled && tree->version == cguiTreeVersion)
+    {
+        return true;
+    }
+
+    tree->compiled   = false;
+    tree->nodesCount = 0;
+
+    if (!CguiAppendCompiledNode(tree, tree->root, -1))
+    {
+        return false;
+    }
+
+    // Pre-order walk using the records themselves as the stack (parent index)
+    // While a record is open, its subtree size holds the next child index to visit
+    int current = 0;
+    while (current != -1)
+    {
+        CguiNode *node       = tree->nodes[current].node;
+        int       childIndex = tree->nodes[current].subtreeSize;
+
+        if (childIndex < node->childrenCount)
+        {
+            tree->nodes[current].subtreeSize++;
+
+            if (!CguiAppendCompiledNode(tree, node->children[childIndex], current))
+            {
+                tree->nodesCount = 0;
+                return false;
+            }
+
+            current = tree->nodesCount - 1;
+            continue;
+        }
+
+        int parent                       = tree->nodes[current].parent;
+        tree->nodes[current].subtreeSize = tree->nodesCount - current;
+        current                          = parent;
+    }
+
+    tree->compiled = true;
+    tree->version  = cguiTreeVersion;
+
+    CG_LOG_TRACE("Compiled tree of %s: %d records", tree->root->name, tree->nodesCount);
+
+    return true;
+}
+
+void CguiInvalidateCompiledTrees(void)
+{
+    cguiTreeVersion++;
+}
+
+void CguiTransformCompiledTree(CguiCompiledTree *tree, bool rebound)
+{
+    if (!CguiCompileTree(tree))
+    {
+        return;
+    }
+
+    unsigned int version = cguiTreeVersion;
+
+    for (int i = 0; i < tree->nodesCount; i++)
+    {
+        CguiCompiledNode *record = &tree->nodes[i];
+        CguiNode         *node   = record->node;
+
+        // Rebound propegates down the tree to all children
+        bool nodeRebound = record->parent == -1 ? rebound : tree->nodes[record->parent].rebound;
+
+        if (record->transform)
+        {
+            nodeRebound |= record->transform(node);
+        }
+
+        nodeRebound |= node->rebound;
+
+        // If node transformation was changed, recalculate bounds
+        if (nodeRebound)
+        {
+            node->bounds  = CguiComputeNodeBounds(node);
+            node->rebound = false;
+        }
+
+        record->rebound = nodeRebound;
+
+        // Transform changed the children, the records of the subtree are stale
+        if (version != cguiTreeVersion)
+        {
+            for (int j = 0; j < node->childrenCount; j++)
+            {
+                CguiTransformNode(node->children[j], nodeRebound);
+            }
+
+            i += record->subtreeSize - 1;
+            version = cguiTreeVersion;
+        }
+    }
+}
+
+// Cull the records and collect the visible nodes in draw order
+static int CguiCullCompiledTree(CguiCompiledTree *tree)
+{
+    int visibleCount = 0;
+
+    for (int i = 0; i < tree->nodesCount;)
+    {
+        CguiCompiledNode *record = &tree->nodes[i];
+
+        // Skip entire subtree
+        if (!record->enabled)
+        {
+            i += record->subtreeSize;
+            continue;
+        }
+
+        Rectangle clip = record->parent == -1 ? CguiGetScissorRec() : tree->nodes[record->parent].clip;
+        record->culled = CguiIsNodeCulled(record->node, clip, &record->cullChildren);
+        record->clip   = CguiClipNodeChildren(record->node, clip);
+
+        if (!record->culled)
+        {
+            tree->visibleNodes[visibleCount++] = record->node;
+        }
+
+        // Optimization: Entire subtree culled
+        i += record->cullChildren ? record->subtreeSize : 1;
+    }
+
+    return visibleCount;
+}
+
+// Post-draw the record unless it was culled
+static void CguiDrawPostCompiledNode(CguiCompiledNode *record)
+{
+    if (!record->culled && record->drawPost)
+    {
+        record->drawPost(record->node);
+    }
+}
+
+void CguiDrawCompiledTree(CguiCompiledTree *tree)
+{
+    if (!CguiCompileTree(tree))
+    {
+        return;
+    }
+
+    unsigned int version = cguiTreeVersion;
+
+    CguiOccludeNodes(tree->visibleNodes, CguiCullCompiledTree(tree));
+
+    // Deepest drawn record whose post-draw is pending, its parents are pending as well
+    int open = -1;
+
+    for (int i = 0; i < tree->nodesCount;)
+    {
+        // Post-draw the records whose subtree ended
+        while (open != -1 && open + tree->nodes[open].subtreeSize <= i)
+        {
+            CguiDrawPostCompiledNode(&tree->nodes[open]);
+            if (version != cguiTreeVersion)
+            {
+                return;
+            }
+
+            open = tree->nodes[open].parent;
+        }
+
+        CguiCompiledNode *record = &tree->nodes[i];
+
+        // Skip entire subtree
+        if (!record->enabled || record->cullChildren)
+        {
+            i += record->subtreeSize;
+            continue;
+        }
+
+        // Pre-draw unless it is culled or occluded (the mark is consumed)
+        bool occluded          = record->node->occluded;
+        record->node->occluded = false;
+
+        if (!record->culled && !occluded && record->drawPre)
+        {
+            record->drawPre(record->node);
+            if (version != cguiTreeVersion)
+            {
+                return;
+            }
+        }
+
+        open = i;
+        i++;
+    }
+
+    while (open != -1)
+    {
+        CguiDrawPostCompiledNode(&tree->nodes[open]);
+        if (version != cguiTreeVersion)
+        {
+            return;
+        }
+
+        open = tree->nodes[open].parent;
+    }
+}
+
+// Whether the point is within the bounds of all the clipping ancestors of the record
+static bool CguiIsCompiledNodeCollidable(CguiCompiledTree *tree, int index, Vector2 point)
+{
+    for (int i = tree->nodes[index].clipParent; i != -1; i = tree->nodes[i].clipParent)
+    {
+        if (!CheckCollisionPointRec(point, tree->nodes[i].node->bounds))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+CguiNode *CguiCheckCompiledCollision(CguiCompiledTree *tree, Vector2 point)
+{
+    if (!CguiCompileTree(tree))
+    {
+        return NULL;
+    }
+
+    // Reverse pre-order is the same order as checking the deepest and last
+    // children first, the first collided record is the top-most drawn node
+    for (int i = tree->nodesCount - 1; i >= 0; i--)
+    {
+        CguiCompiledNode *record = &tree->nodes[i];
+        if (record->enabled && CheckCollisionPointRec(point, record->node->bounds) && CguiIsCompiledNodeCollidable(tree, i, point))
+        {
+            return record->node;
+        }
+    }
+
+    return NULL;
+}
@@ -17,6 +17,19 @@
 
 extern CguiNode *cguiComponentTemplates[];
 
+// Give the copied instance data its own chain, interpolating its own values
+static bool CguiCopyComponentChain(CguiNode *fromNode, CguiNode *toNode, CguiTransitionChain **chain)
+{
+    if (!*chain)
+    {
+        return true;
+    }
+
+    *chain = CguiCloneTransitionChain(*chain, fromNode->instanceData, toNode->instanceData, fromNode->instanceDataSize);
+
+    return *chain != NULL;
+}
+
 void CguiApplyOverrides(CguiNode *node, CguiCommonOverrides overrides)
 {
     if (!node)
@@ -97,11 +110,14 @@ CguiNode *CguiCreateRoot(void)
     CguiRootData         *data  = node->data;
     CguiRootInstanceData *iData = node->instanceData;
 
-    node->override  = CguiOverrideRoot;
-    node->updatePre = CguiPreUpdateRoot;
-    node->drawPre   = CguiPreDrawRoot;
+    node->override     = CguiOverrideRoot;
+    node->updatePre    = CguiPreUpdateRoot;
+    node->drawPre      = CguiPreDrawRoot;
+    node->opaqueBounds = CguiGetRootOpaqueBounds;
 
     iData->targetBackgroundColor = data->backgroundColor;
+    iData->targetSource          = &data->backgroundColor;
+    iData->targetVersion         = data->version;
     iData->transitionChain       = CguiCreateTransitionChain();
 
     if (!iData->transitionChain)
@@ -126,6 +142,10 @@ CguiNode *CguiCreateRoot(void)
         return NULL;
     }
 
+    // Chain is owned by the node from now on
+    node->deleteNodeData = CguiDeleteRootData;
+    node->copyNodeData   = CguiCopyRootData;
+
     CguiOverrideTransformation(node, &iData->overrides, CguiTFillParent());
 
     return node;
@@ -146,18 +166,16 @@ void CguiPreUpdateRoot(CguiNode *node)
     CguiRootData         *data  = node->data;
     CguiRootInstanceData *iData = node->instanceData;
 
-    if (!CguiIsColorEqual(iData->targetBackgroundColor, data->backgroundColor))
+    // Optimization: Target is only copied when the data is resynced or its version changes
+    if (iData->targetSource != &data->backgroundColor || iData->targetVersion != data->version)
     {
+        iData->targetSource           = &data->backgroundColor;
+        iData->targetVersion          = data->version;
         iData->targetBackgroundColor  = data->backgroundColor;
         iData->currentBackgroundColor = iData->transitioningBackgroundColor;
 
-        CguiTransition *transition         = iData->transitionChain->first;
-        iData->transitionChain->active     = transition;
-        iData->transitionChain->activeTime = 0.0f;
-        iData->transitionChain->finished   = false;
+        CguiRestartTransitionChain(iData->transitionChain);
     }
-
-    CguiUpdateTransitionChain(iData->transitionChain);
 }
 
 void CguiPreDrawRoot(CguiNode *node)
@@ -175,7 +193,24 @@ void CguiPreDrawRoot(CguiNode *node)
     CguiRootData         *data  = node->data;
     CguiRootInstanceData *iData = node->instanceData;
 
-    DrawRectangleRec(node->bounds, iData->transitioningBackgroundColor);
+    CguiEmitRectangle(node->bounds, iData->transitioningBackgroundColor);
+}
+
+Rectangle CguiGetRootOpaqueBounds(CguiNode *node)
+{
+    if (!node)
+    {
+        return CguiGetNodeOpaqueBounds(NULL);
+    }
+
+    if (node->type != CGUI_COMPONENT_NODE_TYPE_ROOT || !node->data || !node->instanceData)
+    {
+        return CguiGetNodeOpaqueBounds(NULL);
+    }
+
+    CguiRootInstanceData *iData = node->instanceData;
+
+    return iData->transitioningBackgroundColor.a == 255 ? node->bounds : CguiGetNodeOpaqueBounds(NULL);
 }
 
 void CguiOverrideRoot(CguiNode *node)
@@ -193,12 +228,46 @@ void CguiOverrideRoot(CguiNode *node)
     CguiRootData         *data  = node->data;
     CguiRootInstanceData *iData = node->instanceData;
 
-    node->updatePre = CguiPreUpdateRoot;
-    node->drawPre   = CguiPreDrawRoot;
+    node->updatePre      = CguiPreUpdateRoot;
+    node->drawPre        = CguiPreDrawRoot;
+    node->opaqueBounds   = CguiGetRootOpaqueBounds;
+    node->deleteNodeData = CguiDeleteRootData;
+    node->copyNodeData   = CguiCopyRootData;
+
+    // Target is selected again from the resynced data
+    iData->targetSource = NULL;
 
     CguiApplyOverrides(node, iData->overrides);
 }
 
+void CguiDeleteRootData(CguiNode *node)
+{
+    if (!node || node->type != CGUI_COMPONENT_NODE_TYPE_ROOT || !node->instanceData)
+    {
+        return;
+    }
+
+    CguiRootInstanceData *iData = node->instanceData;
+
+    CguiDeleteTransitionChain(iData->transitionChain);
+    iData->transitionChain = NULL;
+}
+
+bool CguiCopyRootData(CguiNode *fromNode, CguiNode *toNode)
+{
+    if (!fromNode || !toNode || toNode->type != CGUI_COMPONENT_NODE_TYPE_ROOT || !fromNode->instanceData || !toNode->instanceData)
+    {
+        return false;
+    }
+
+    CguiRootInstanceData *iData = toNode->instanceData;
+
+    // Target is selected again from the copied data
+    iData->targetSource = NULL;
+
+    return CguiCopyComponentChain(fromNode, toNode, &iData->transitionChain);
+}
+
 CguiNode *CguiCreateLayer(CguiTransformation transformation, int type)
 {
     CguiNode *node = CguiCreateInstance(cguiComponentTemplates[CGUI_COMPONENT_LAYER]);
@@ -238,6 +307,8 @@ CguiNode *CguiCreateLayer(CguiTransformation transformation, int type)
     if (iData->type >= 0 && iData->type < CGUI_LAYER_TYPE_MAX)
     {
         iData->targetBoxData = data->boxDatas[iData->type];
+        iData->targetSource  = &data->boxDatas[iData->type];
+        iData->targetVersion = data->version;
     }
 
     iData->transitionChain = CguiCreateTransitionChain();
@@ -264,6 +335,9 @@ CguiNode *CguiCreateLayer(CguiTransformation transformation, int type)
         return NULL;
     }
 
+    node->deleteNodeData = CguiDeleteLayerData;
+    node->copyNodeData   = CguiCopyLayerData;
+
     CguiOverrideTransformation(node, &iData->overrides, transformation);
 
     return node;
@@ -301,22 +375,26 @@ void CguiPreUpdateLayer(CguiNode *node)
         return;
     }
 
-    CguiBoxElementData boxData = data->boxDatas[iData->type];
+    // Optimization: Box data is selected by address, it is only copied when the type changes, the data is resynced or its version changes
+    const CguiBoxElementData *boxData = &data->boxDatas[iData->type];
 
-    if (!CguiIsBoxElementDataEqual(iData->targetBoxData, boxData))
+    if (iData->targetSource != boxData || iData->targetVersion != data->version)
     {
-        iData->targetBoxData  = boxData;
+        iData->targetSource   = boxData;
+        iData->targetVersion  = data->version;
+        iData->targetBoxData  = *boxData;
         iData->currentBoxData = iData->transitioningBoxData;
+        iData->targetApplied  = false;
 
-        CguiTransition *transition         = iData->transitionChain->first;
-        iData->transitionChain->active     = transition;
-        iData->transitionChain->activeTime = 0.0f;
-        iData->transitionChain->finished   = false;
+        CguiRestartTransitionChain(iData->transitionChain);
     }
 
-    CguiUpdateTransitionChain(iData->transitionChain);
-
-    *boxNodeData = iData->transitioningBoxData;
+    // Optimization: Transitioning data only changes while the chain is scheduled, copied once more after it is unscheduled
+    if (!iData->targetApplied)
+    {
+        *boxNodeData         = iData->transitioningBoxData;
+        iData->targetApplied = !iData->transitionChain || iData->transitionChain->scheduledSlot == 0;
+    }
 }
 
 void CguiOverrideLayer(CguiNode *node)
@@ -346,11 +424,44 @@ void CguiOverrideLayer(CguiNode *node)
 
     CguiTextElementData *boxNodeData = boxNodeRef->data;
 
-    node->updatePre = CguiPreUpdateLayer;
+    node->updatePre      = CguiPreUpdateLayer;
+    node->deleteNodeData = CguiDeleteLayerData;
+    node->copyNodeData   = CguiCopyLayerData;
+
+    // Target is selected again from the resynced data
+    iData->targetSource = NULL;
 
     CguiApplyOverrides(node, iData->overrides);
 }
 
+void CguiDeleteLayerData(CguiNode *node)
+{
+    if (!node || node->type != CGUI_COMPONENT_NODE_TYPE_LAYER || !node->instanceData)
+    {
+        return;
+    }
+
+    CguiLayerInstanceData *iData = node->instanceData;
+
+    CguiDeleteTransitionChain(iData->transitionChain);
+    iData->transitionChain = NULL;
+}
+
+bool CguiCopyLayerData(CguiNode *fromNode, CguiNode *toNode)
+{
+    if (!fromNode || !toNode || toNode->type != CGUI_COMPONENT_NODE_TYPE_LAYER || !fromNode->instanceData || !toNode->instanceData)
+    {
+        return false;
+    }
+
+    CguiLayerInstanceData *iData = toNode->instanceData;
+
+    // Target is selected again from the copied data
+    iData->targetSource = NULL;
+
+    return CguiCopyComponentChain(fromNode, toNode, &iData->transitionChain);
+}
+
 CguiNode *CguiCreateLabel(CguiTransformation transformation, const char *text, int type, bool disabled, int xJustify, int yJustify)
 {
     CguiNode *node = CguiCreateInstance(cguiComponentTemplates[CGUI_COMPONENT_LABEL]);
@@ -385,6 +496,8 @@ CguiNode *CguiCreateLabel(CguiTransformation transformation, const char *text, i
     if (iData->type >= 0 && iData->type < CGUI_LAYER_TYPE_MAX)
     {
         iData->targetTextData = data->textDatas[iData->type];
+        iData->targetSource   = &data->textDatas[iData->type];
+        iData->targetVersion  = data->version;
     }
 
     iData->transitionChain = CguiCreateTransitionChain();
@@ -411,8 +524,10 @@ CguiNode *CguiCreateLabel(CguiTransformation transformation, const char *text, i
         return NULL;
     }
 
-    node->override  = CguiOverrideLabel;
-    node->updatePre = CguiPreUpdateLabel;
+    node->override       = CguiOverrideLabel;
+    node->updatePre      = CguiPreUpdateLabel;
+    node->deleteNodeData = CguiDeleteLabelData;
+    node->copyNodeData   = CguiCopyLabelData;
 
     iData->text     = text;
     iData->type     = type;
@@ -457,27 +572,31 @@ void CguiPreUpdateLabel(CguiNode *node)
         return;
     }
 
-    CguiTextElementData textData = data->textDatas[iData->type];
+    // Optimization: Text data is selected by address, it is only copied when the state changes, the data is resynced or its version changes
+    const CguiTextElementData *textData = &data->textDatas[iData->type];
 
     if (iData->disabled)
     {
-        textData = data->disabledTextDatas[iData->type];
+        textData = &data->disabledTextDatas[iData->type];
     }
 
-    if (!CguiIsTextElementDataEqual(iData->targetTextData, textData))
+    if (iData->targetSource != textData || iData->targetVersion != data->version)
     {
-        iData->targetTextData  = textData;
+        iData->targetSource    = textData;
+        iData->targetVersion   = data->version;
+        iData->targetTextData  = *textData;
         iData->currentTextData = iData->transitioningTextData;
+        iData->targetApplied   = false;
 
-        CguiTransition *transition         = iData->transitionChain->first;
-        iData->transitionChain->active     = transition;
-        iData->transitionChain->activeTime = 0.0f;
-        iData->transitionChain->finished   = false;
+        CguiRestartTransitionChain(iData->transitionChain);
     }
 
-    CguiUpdateTransitionChain(iData->transitionChain);
-
-    *textNodeData = iData->transitioningTextData;
+    // Optimization: Transitioning data only changes while the chain is scheduled, copied once more after it is unscheduled
+    if (!iData->targetApplied)
+    {
+        *textNodeData        = iData->transitioningTextData;
+        iData->targetApplied = !iData->transitionChain || iData->transitionChain->scheduledSlot == 0;
+    }
 
     textNodeData->text     = iData->text;
     textNodeData->xJustify = iData->xJustify;
@@ -511,11 +630,44 @@ void CguiOverrideLabel(CguiNode *node)
 
     CguiTextElementData *textNodeData = textNodeRef->data;
 
-    node->updatePre = CguiPreUpdateLabel;
+    node->updatePre      = CguiPreUpdateLabel;
+    node->deleteNodeData = CguiDeleteLabelData;
+    node->copyNodeData   = CguiCopyLabelData;
+
+    // Target is selected again from the resynced data
+    iData->targetSource = NULL;
 
     CguiApplyOverrides(node, iData->overrides);
 }
 
+void CguiDeleteLabelData(CguiNode *node)
+{
+    if (!node || node->type != CGUI_COMPONENT_NODE_TYPE_LABEL || !node->instanceData)
+    {
+        return;
+    }
+
+    CguiLabelInstanceData *iData = node->instanceData;
+
+    CguiDeleteTransitionChain(iData->transitionChain);
+    iData->transitionChain = NULL;
+}
+
+bool CguiCopyLabelData(CguiNode *fromNode, CguiNode *toNode)
+{
+    if (!fromNode || !toNode || toNode->type != CGUI_COMPONENT_NODE_TYPE_LABEL || !fromNode->instanceData || !toNode->instanceData)
+    {
+        return false;
+    }
+
+    CguiLabelInstanceData *iData = toNode->instanceData;
+
+    // Target is selected again from the copied data
+    iData->targetSource = NULL;
+
+    return CguiCopyComponentChain(fromNode, toNode, &iData->transitionChain);
+}
+
 CguiNode *CguiCreateButton(CguiTransformation transformation, int type, CguiButtonPressCallback pressCallback, bool disabled)
 {
     CguiNode *node = CguiCreateInstance(cguiComponentTemplates[CGUI_COMPONENT_BUTTON]);
@@ -555,7 +707,12 @@ CguiNode *CguiCreateButton(CguiTransformation transformation, int type, CguiButt
         return NULL;
     }
 
-    CguiTransition *transition = CguiTransitBoxElementData(&iData->currentBoxData, &iData->targetBoxData, &iData->transitioningBoxData, data->transitionEasing, data->transitionDuration);
+    CguiTransition *transition = NULL;
+    if (data->transitionSpring)
+        transition = CguiSpringBoxElementData(&iData->currentBoxData, &iData->targetBoxData, &iData->transitioningBoxData, data->transitionDuration);
+    else
+        transition = CguiTransitBoxElementData(&iData->currentBoxData, &iData->targetBoxData, &iData->transitioningBoxData, data->transitionEasing, data->transitionDuration);
+
     if (!transition)
     {
         CguiDeleteTransitionChain(iData->transitionChain);
@@ -573,6 +730,8 @@ CguiNode *CguiCreateButton(CguiTransformation transformation, int type, CguiButt
 
     node->override             = CguiOverrideButton;
     node->updatePre            = CguiPreUpdateButton;
+    node->deleteNodeData       = CguiDeleteButtonData;
+    node->copyNodeData         = CguiCopyButtonData;
     node->canHandleMouseEvents = true;
     node->handleEvent          = CguiHandleButtonEvents;
 
@@ -620,37 +779,42 @@ void CguiPreUpdateButton(CguiNode *node)
         return;
     }
 
-    CguiBoxElementData boxData = data->boxDatas[iData->type];
+    // Optimization: Box data is selected by address, it is only copied when the state changes, the data is resynced or its version changes
+    const CguiBoxElementData *boxData = &data->boxDatas[iData->type];
 
     if (iData->hovered)
     {
-        boxData = data->hoveredBoxDatas[iData->type];
+        boxData = &data->hoveredBoxDatas[iData->type];
     }
 
     if (iData->held)
     {
-        boxData = data->heldBoxDatas[iData->type];
+        boxData = &data->heldBoxDatas[iData->type];
     }
 
     if (iData->disabled)
     {
-        boxData = data->disabledBoxDatas[iData->type];
+        boxData = &data->disabledBoxDatas[iData->type];
     }
 
-    if (!CguiIsBoxElementDataEqual(iData->targetBoxData, boxData))
+    if (iData->targetSource != boxData || iData->targetVersion != data->version)
     {
-        iData->targetBoxData  = boxData;
+        iData->targetSource   = boxData;
+        iData->targetVersion  = data->version;
+        iData->targetBoxData  = *boxData;
         iData->currentBoxData = iData->transitioningBoxData;
+        iData->targetApplied  = false;
 
-        CguiTransition *transition         = iData->transitionChain->first;
-        iData->transitionChain->active     = transition;
-        iData->transitionChain->activeTime = 0.0f;
-        iData->transitionChain->finished   = false;
+        // Springs keep their motion towards the new target, eases restart
+        CguiRetargetTransitionChain(iData->transitionChain);
     }
 
-    CguiUpdateTransitionChain(iData->transitionChain);
-
-    *boxNodeData = iData->transitioningBoxData;
+    // Optimization: Transitioning data only changes while the chain is scheduled, copied once more after it is unscheduled
+    if (!iData->targetApplied)
+    {
+        *boxNodeData         = iData->transitioningBoxData;
+        iData->targetApplied = !iData->transitionChain || iData->transitionChain->scheduledSlot == 0;
+    }
 }
 
 void CguiOverrideButton(CguiNode *node)
@@ -681,12 +845,45 @@ void CguiOverrideButton(CguiNode *node)
     CguiBoxElementData *boxNodeData = boxNodeRef->data;
 
     node->updatePre            = CguiPreUpdateButton;
+    node->deleteNodeData       = CguiDeleteButtonData;
+    node->copyNodeData         = CguiCopyButtonData;
     node->canHandleMouseEvents = true;
     node->handleEvent          = CguiHandleButtonEvents;
 
+    // Target is selected again from the resynced data
+    iData->targetSource = NULL;
+
     CguiApplyOverrides(node, iData->overrides);
 }
 
+void CguiDeleteButtonData(CguiNode *node)
+{
+    if (!node || node->type != CGUI_COMPONENT_NODE_TYPE_BUTTON || !node->instanceData)
+    {
+        return;
+    }
+
+    CguiButtonInstanceData *iData = node->instanceData;
+
+    CguiDeleteTransitionChain(iData->transitionChain);
+    iData->transitionChain = NULL;
+}
+
+bool CguiCopyButtonData(CguiNode *fromNode, CguiNode *toNode)
+{
+    if (!fromNode || !toNode || toNode->type != CGUI_COMPONENT_NODE_TYPE_BUTTON || !fromNode->instanceData || !toNode->instanceData)
+    {
+        return false;
+    }
+
+    CguiButtonInstanceData *iData = toNode->instanceData;
+
+    // Target is selected again from the copied data
+    iData->targetSource = NULL;
+
+    return CguiCopyComponentChain(fromNode, toNode, &iData->transitionChain);
+}
+
 bool CguiHandleButtonEvents(CguiNode *node, CguiEvent *event)
 {
     if (!node || !event)
@@ -806,7 +1003,12 @@ CguiNode *CguiCreateToggle(CguiTransformation transformation, bool active, CguiT
         return NULL;
     }
 
-    CguiTransition *transition = CguiTransitBoxElementData(&iData->currentBoxData, &iData->targetBoxData, &iData->transitioningBoxData, data->transitionEasing, data->transitionDuration);
+    CguiTransition *transition = NULL;
+    if (data->transitionSpring)
+        transition = CguiSpringBoxElementData(&iData->currentBoxData, &iData->targetBoxData, &iData->transitioningBoxData, data->transitionDuration);
+    else
+        transition = CguiTransitBoxElementData(&iData->currentBoxData, &iData->targetBoxData, &iData->transitioningBoxData, data->transitionEasing, data->transitionDuration);
+
     if (!transition)
     {
         CguiDeleteTransitionChain(iData->transitionChain);
@@ -824,6 +1026,8 @@ CguiNode *CguiCreateToggle(CguiTransformation transformation, bool active, CguiT
 
     node->override             = CguiOverrideToggle;
     node->updatePre            = CguiPreUpdateToggle;
+    node->deleteNodeData       = CguiDeleteToggleData;
+    node->copyNodeData         = CguiCopyToggleData;
     node->canHandleMouseEvents = true;
     node->handleEvent          = CguiHandleToggleEvents;
 
@@ -864,61 +1068,66 @@ void CguiPreUpdateToggle(CguiNode *node)
 
     CguiBoxElementData *boxNodeData = boxNodeRef->data;
 
-    CguiBoxElementData boxData = data->boxData;
+    // Optimization: Box data is selected by address, it is only copied when the state changes, the data is resynced or its version changes
+    const CguiBoxElementData *boxData = &data->boxData;
 
     if (iData->active)
     {
-        boxData = data->activeBoxData;
+        boxData = &data->activeBoxData;
 
         if (iData->hovered)
         {
-            boxData = data->activeHoveredBoxData;
+            boxData = &data->activeHoveredBoxData;
         }
 
         if (iData->held)
         {
-            boxData = data->activeHeldBoxData;
+            boxData = &data->activeHeldBoxData;
         }
 
         if (iData->disabled)
         {
-            boxData = data->activeDisabledBoxData;
+            boxData = &data->activeDisabledBoxData;
         }
     }
     else
     {
-        boxData = data->boxData;
+        boxData = &data->boxData;
 
         if (iData->hovered)
         {
-            boxData = data->hoveredBoxData;
+            boxData = &data->hoveredBoxData;
         }
 
         if (iData->held)
         {
-            boxData = data->heldBoxData;
+            boxData = &data->heldBoxData;
         }
 
         if (iData->disabled)
         {
-            boxData = data->disabledBoxData;
+            boxData = &data->disabledBoxData;
         }
     }
 
-    if (!CguiIsBoxElementDataEqual(iData->targetBoxData, boxData))
+    if (iData->targetSource != boxData || iData->targetVersion != data->version)
     {
-        iData->targetBoxData  = boxData;
+        iData->targetSource   = boxData;
+        iData->targetVersion  = data->version;
+        iData->targetBoxData  = *boxData;
         iData->currentBoxData = iData->transitioningBoxData;
+        iData->targetApplied  = false;
 
-        CguiTransition *transition         = iData->transitionChain->first;
-        iData->transitionChain->active     = transition;
-        iData->transitionChain->activeTime = 0.0f;
-        iData->transitionChain->finished   = false;
+        // Springs keep their motion towards the new target, eases restart
+        CguiRetargetTransitionChain(iData->transitionChain);
     }
 
-    CguiUpdateTransitionChain(iData->transitionChain);
-
-    *boxNodeData = iData->transitioningBoxData;
+    // Optimization: Transitioning data only changes while the chain is scheduled, copied once more after it is unscheduled
+    if (!iData->targetApplied)
+    {
+        *boxNodeData         = iData->transitioningBoxData;
+        iData->targetApplied = !iData->transitionChain || iData->transitionChain->scheduledSlot == 0;
+    }
 }
 
 void CguiOverrideToggle(CguiNode *node)
@@ -949,12 +1158,45 @@ void CguiOverrideToggle(CguiNode *node)
     CguiBoxElementData *boxNodeData = boxNodeRef->data;
 
     node->updatePre            = CguiPreUpdateToggle;
+    node->deleteNodeData       = CguiDeleteToggleData;
+    node->copyNodeData         = CguiCopyToggleData;
     node->canHandleMouseEvents = true;
     node->handleEvent          = CguiHandleToggleEvents;
 
+    // Target is selected again from the resynced data
+    iData->targetSource = NULL;
+
     CguiApplyOverrides(node, iData->overrides);
 }
 
+void CguiDeleteToggleData(CguiNode *node)
+{
+    if (!node || node->type != CGUI_COMPONENT_NODE_TYPE_TOGGLE || !node->instanceData)
+    {
+        return;
+    }
+
+    CguiToggleInstanceData *iData = node->instanceData;
+
+    CguiDeleteTransitionChain(iData->transitionChain);
+    iData->transitionChain = NULL;
+}
+
+bool CguiCopyToggleData(CguiNode *fromNode, CguiNode *toNode)
+{
+    if (!fromNode || !toNode || toNode->type != CGUI_COMPONENT_NODE_TYPE_TOGGLE || !fromNode->instanceData || !toNode->instanceData)
+    {
+        return false;
+    }
+
+    CguiToggleInstanceData *iData = toNode->instanceData;
+
+    // Target is selected again from the copied data
+    iData->targetSource = NULL;
+
+    return CguiCopyComponentChain(fromNode, toNode, &iData->transitionChain);
+}
+
 bool CguiHandleToggleEvents(CguiNode *node, CguiEvent *event)
 {
     if (!node || !event)
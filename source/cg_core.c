@@ -21,8 +21,62 @@ Shader                                cguiBoxShader
 CguiTheme                            *cguiDefaultTheme                           = NULL;
 CguiTheme                            *cguiActiveTheme                            = NULL;
 CguiNode                             *cguiComponentTemplates[CGUI_COMPONENT_MAX] = { 0 };
-CguiNode                             *cguiMouseButtonPressedNode                 = NULL;
-struct CguiRegisteredTransitionChain *cguiRegisteredTransitionChains                  = NULL;
+CguiNodeHandle                        cguiMouseButtonPressedNode                 = (CguiNodeHandle) { 0 };
+struct CguiRegisteredTransitionChain *cguiRegisteredTransitionChains             = NULL;
+int                                   cguiRegisteredTransitionChainsCount        = 0;
+int                                   cguiRegisteredTransitionChainsCapacity     = 0;
+struct CguiTransitionSlot            *cguiTransitionSlots                        = NULL;
+int                                   cguiTransitionSlotsCount                   = 0;
+int                                   cguiTransitionSlotsCapacity                = 0;
+int                                   cguiTransitionFreeSlot                     = -1;
+struct CguiTraversalEntry            *cguiTraversalStack                         = NULL;
+int                                   cguiTraversalStackCount                    = 0;
+int                                   cguiTraversalStackCapacity                 = 0;
+unsigned int                          cguiTreeVersion                            = 0;
+float                                *cguiBoundsBatch                            = NULL;
+int                                   cguiBoundsBatchCapacity                    = 0;
+CguiNode                            **cguiDeleteQueue                            = NULL;
+int                                   cguiDeleteQueueCount                       = 0;
+int                                   cguiDeleteQueueCapacity                    = 0;
+struct CguiHandleSlot                *cguiHandleSlots                            = NULL;
+int                                   cguiHandleSlotsCount                       = 0;
+int                                   cguiHandleSlotsCapacity                    = 0;
+int                                   cguiHandleFreeSlot                         = -1;
+Rectangle                            *cguiScissorStack                           = NULL;
+int                                   cguiScissorStackCount                      = 0;
+int                                   cguiScissorStackCapacity                   = 0;
+CguiNode                            **cguiOcclusionNodes                         = NULL;
+int                                   cguiOcclusionNodesCount                    = 0;
+int                                   cguiOcclusionNodesCapacity                 = 0;
+CguiDrawList                         *cguiActiveDrawList                         = NULL;
+CguiDrawList                         *cguiFrameDrawList                          = NULL;
+int                                   cguiAppWidthOverride                       = 0;
+int                                   cguiAppHeightOverride                      = 0;
+union CguiTransitionPoolItem        **cguiTransitionPoolPages                    = NULL;
+int                                   cguiTransitionPoolPagesCount               = 0;
+int                                   cguiTransitionPoolPagesCapacity            = 0;
+union CguiTransitionPoolItem         *cguiTransitionPoolFree                     = NULL;
+int                                   cguiTransitionPoolUsed                     = 0;
+float                                *cguiInterpLanesFrom                        = NULL;
+float                                *cguiInterpLanesTo                          = NULL;
+float                                *cguiInterpLanesT                           = NULL;
+void                                **cguiInterpLanesResult                      = NULL;
+unsigned char                        *cguiInterpLanesKind                        = NULL;
+int                                   cguiInterpLanesCount                       = 0;
+int                                   cguiInterpLanesCapacity                    = 0;
+int                                   cguiTransitionBatchDepth                   = 0;
+int                                   cguiEaseBatchInstructionSet                = -1;
+CguiTimeFunction                      cguiTransitionTimeFunction                 = NULL;
+bool                                  cguiTransitionClockStarted                 = false;
+double                                cguiTransitionLastTime                     = 0.0;
+double                                cguiTransitionAccumulator                  = 0.0;
+float                                 cguiTransitionDeltaTime                    = 0.0f;
+float                                 cguiTransitionStepTime                     = 0.0f;
+int                                   cguiTransitionStepsCount                   = 0;
+float                                 cguiTransitionFixedStep                    = 0.0f;
+CguiTransitionChain                 **cguiScheduledChains                        = NULL;
+int                                   cguiScheduledChainsCount                   = 0;
+int                                   cguiScheduledChainsCapacity                = 0;
 
 #define CGUI_GLSL_VERSION 330
 
@@ -33,10 +87,18 @@ void CguiInit(void)
         return;
     }
 
-    cguiBoxShader = LoadShader(NULL, TextFormat("resource/shaders/glsl%i/box.fs", CGUI_GLSL_VERSION));
-    if (cguiBoxShader.id == 0)
+    // Shaders need a GPU context, without a window only software rendering is available
+    if (!IsWindowReady())
     {
-        CG_LOG_ERROR("Failed to load Box Shader. Are you missing \"resource\" folder in working directory?");
+        CG_LOG_INFO("No window, Box Shader is not loaded");
+    }
+    else
+    {
+        cguiBoxShader = LoadShader(NULL, TextFormat("resource/shaders/glsl%i/box.fs", CGUI_GLSL_VERSION));
+        if (cguiBoxShader.id == 0)
+        {
+            CG_LOG_ERROR("Failed to load Box Shader. Are you missing \"resource\" folder in working directory?");
+        }
     }
 
     cguiDefaultTheme = CguiCreateCrystallineThemeDark();
@@ -46,6 +108,13 @@ void CguiInit(void)
     }
     CguiSetActiveTheme(cguiDefaultTheme);
 
+    // Drawing is submitted right away without a frame list
+    cguiFrameDrawList = CguiCreateDrawList();
+    if (!cguiFrameDrawList)
+    {
+        CG_LOG_ERROR("Failed to create frame draw list");
+    }
+
     cguiInited = true;
 }
 
@@ -56,10 +125,72 @@ void CguiClose(void)
         return;
     }
 
+    CguiFlushDeleteQueue(0);
+    CG_FREE_NULL(cguiDeleteQueue);
+    cguiDeleteQueueCount    = 0;
+    cguiDeleteQueueCapacity = 0;
+
     CguiDeleteTheme(cguiDefaultTheme);
 
+    CguiDeleteDrawList(cguiFrameDrawList);
+    cguiFrameDrawList = NULL;
+
     UnloadShader(cguiBoxShader);
 
+    CG_FREE_NULL(cguiTraversalStack);
+    cguiTraversalStackCount    = 0;
+    cguiTraversalStackCapacity = 0;
+
+    CG_FREE_NULL(cguiBoundsBatch);
+    cguiBoundsBatchCapacity = 0;
+
+    CG_FREE_NULL(cguiScissorStack);
+    cguiScissorStackCount    = 0;
+    cguiScissorStackCapacity = 0;
+
+    CG_FREE_NULL(cguiOcclusionNodes);
+    cguiOcclusionNodesCount    = 0;
+    cguiOcclusionNodesCapacity = 0;
+
+    CguiResetTransitionClock();
+
+    CguiClearRegisteredTransitions();
+    CG_FREE_NULL(cguiRegisteredTransitionChains);
+    cguiRegisteredTransitionChainsCount    = 0;
+    cguiRegisteredTransitionChainsCapacity = 0;
+
+    CG_FREE_NULL(cguiTransitionSlots);
+    cguiTransitionSlotsCount    = 0;
+    cguiTransitionSlotsCapacity = 0;
+    cguiTransitionFreeSlot      = -1;
+
+    // Chains are not owned
+    for (int i = 0; i < cguiScheduledChainsCount; i++)
+    {
+        cguiScheduledChains[i]->scheduledSlot = 0;
+    }
+
+    CG_FREE_NULL(cguiScheduledChains);
+    cguiScheduledChainsCount    = 0;
+    cguiScheduledChainsCapacity = 0;
+
+    CG_FREE_NULL(cguiInterpLanesFrom);
+    CG_FREE_NULL(cguiInterpLanesTo);
+    CG_FREE_NULL(cguiInterpLanesT);
+    CG_FREE_NULL(cguiInterpLanesResult);
+    CG_FREE_NULL(cguiInterpLanesKind);
+    cguiInterpLanesCount     = 0;
+    cguiInterpLanesCapacity  = 0;
+    cguiTransitionBatchDepth = 0;
+
+    // Kept if transitions are still in use
+    CguiTrimTransitionPool();
+
+    CG_FREE_NULL(cguiHandleSlots);
+    cguiHandleSlotsCount    = 0;
+    cguiHandleSlotsCapacity = 0;
+    cguiHandleFreeSlot      = -1;
+
     cguiInited = false;
 }
 
@@ -72,17 +203,39 @@ void CguiUpdate(CguiNode *root)
 
     CguiSyncHierarchy(root);
 
-    CguiUpdateRegisteredTransitions();
+    CguiTickTransitionClock();
+
+    // Chains advance one step at a time, and at least once to apply their values
+    int steps = CguiGetTransitionStepsCount();
+    for (int i = 0; i < steps || i == 0; i++)
+    {
+        // Interpolated together in one sweep
+        CguiBeginTransitionBatch();
+        CguiUpdateRegisteredTransitions();
+        CguiUpdateScheduledTransitions();
+        CguiEndTransitionBatch();
+    }
 
     CguiTransformNode(root, IsWindowResized());
 
     CguiDispatchEvents(root);
 
     CguiUpdateNode(root);
+
+    // Queued nodes are no longer referenced by this update
+    CguiFlushDeleteQueue(CG_DELETE_QUEUE_FRAME_LIMIT);
 }
 
 void CguiDraw(CguiNode *root, bool debugBounds)
 {
+    // Record the tree, then submit it sorted by state
+    CguiBeginDrawList(cguiFrameDrawList);
     CguiDrawNode(root);
+    CguiEndDrawList();
+
+    CguiSortDrawList(cguiFrameDrawList);
+    CguiSubmitDrawList(cguiFrameDrawList);
+    CguiClearDrawList(cguiFrameDrawList);
+
     if (debugBounds) CguiDebugDrawNode(root);
 }
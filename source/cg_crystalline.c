@@ -42,6 +42,12 @@ static Color CguiColorFromSLAaHsL(Vector3 sva, float hue, float lightness) // Sa
     return CguiColorFromHSLA(hue, sva.x, lightness, sva.z);
 }
 
+// Fonts are loaded to the GPU, without a window they are left empty (texts are not drawn)
+static Font CguiLoadCrystallineFont(const char *fileName, int fontSize)
+{
+    return IsWindowReady() ? LoadFontEx(fileName, fontSize, NULL, 0) : (Font) { 0 };
+}
+
 CguiTheme *CguiCreateCrystallineThemeDark(void)
 {
     CguiCrystallineThemeData data    = { 0 };
@@ -90,12 +96,12 @@ CguiTheme *CguiCreateCrystallineThemeDark(void)
     data.headingLineHeight           = 1.25f;
     data.bodyLineHeight              = 1.375f;
     data.captionLineHeight           = 1.5f;
-    data.textFont                    = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Regular.ttf", 18, NULL, 0);
-    data.textFontItalic              = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Italic.ttf", 18, NULL, 0);
-    data.textFontBold                = LoadFontEx("resource/fonts/Inter/static/Inter_24pt-SemiBold.ttf", 24, NULL, 0);
-    data.textFontBoldItalic          = LoadFontEx("resource/fonts/Inter/static/Inter_24pt-SemiBoldItalic.ttf", 24, NULL, 0);
-    data.textFontLight               = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Light.ttf", 14, NULL, 0);
-    data.textFontLightItalic         = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-LightItalic.ttf", 14, NULL, 0);
+    data.textFont                    = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Regular.ttf", 18);
+    data.textFontItalic              = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Italic.ttf", 18);
+    data.textFontBold                = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_24pt-SemiBold.ttf", 24);
+    data.textFontBoldItalic          = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_24pt-SemiBoldItalic.ttf", 24);
+    data.textFontLight               = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Light.ttf", 14);
+    data.textFontLightItalic         = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-LightItalic.ttf", 14);
     data.backlayerRadii              = (Vector4) { 20.0f, 20.0f, 20.0f, 20.0f };
     data.midlayerRadii               = (Vector4) { 15.0f, 15.0f, 15.0f, 15.0f };
     data.frontlayerRadii             = (Vector4) { 10.0f, 10.0f, 10.0f, 10.0f };
@@ -114,6 +120,7 @@ CguiTheme *CguiCreateCrystallineThemeDark(void)
     data.componentBorderSLA          = (Vector3) { 0.0f, 1.0f, 0.050f };
     data.componentTransitionDuration = 0.25f;
     data.componentTransitionEasing   = CguiEaseInOutQuad;
+    data.componentTransitionSpring   = false;
 
     return CguiCreateCrystallineThemeFromData(data);
 }
@@ -166,12 +173,12 @@ CguiTheme *CguiCreateCrystallineThemeLight(void)
     data.headingLineHeight           = 1.25f;
     data.bodyLineHeight              = 1.375f;
     data.captionLineHeight           = 1.5f;
-    data.textFont                    = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Regular.ttf", 18, NULL, 0);
-    data.textFontItalic              = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Italic.ttf", 18, NULL, 0);
-    data.textFontBold                = LoadFontEx("resource/fonts/Inter/static/Inter_24pt-SemiBold.ttf", 24, NULL, 0);
-    data.textFontBoldItalic          = LoadFontEx("resource/fonts/Inter/static/Inter_24pt-SemiBoldItalic.ttf", 24, NULL, 0);
-    data.textFontLight               = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Light.ttf", 14, NULL, 0);
-    data.textFontLightItalic         = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-LightItalic.ttf", 14, NULL, 0);
+    data.textFont                    = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Regular.ttf", 18);
+    data.textFontItalic              = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Italic.ttf", 18);
+    data.textFontBold                = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_24pt-SemiBold.ttf", 24);
+    data.textFontBoldItalic          = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_24pt-SemiBoldItalic.ttf", 24);
+    data.textFontLight               = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Light.ttf", 14);
+    data.textFontLightItalic         = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-LightItalic.ttf", 14);
     data.backlayerRadii              = (Vector4) { 20.0f, 20.0f, 20.0f, 20.0f };
     data.midlayerRadii               = (Vector4) { 15.0f, 15.0f, 15.0f, 15.0f };
     data.frontlayerRadii             = (Vector4) { 10.0f, 10.0f, 10.0f, 10.0f };
@@ -190,6 +197,7 @@ CguiTheme *CguiCreateCrystallineThemeLight(void)
     data.componentBorderSLA          = (Vector3) { 0.0f, 0.0f, 0.000f }; // No border
     data.componentTransitionDuration = 0.25f;
     data.componentTransitionEasing   = CguiEaseInOutQuad;
+    data.componentTransitionSpring   = false;
 
     return CguiCreateCrystallineThemeFromData(data);
 }
@@ -242,12 +250,12 @@ CguiTheme *CguiCreateCrystallineThemeDarkHighContrast(void)
     data.headingLineHeight           = 1.25f;
     data.bodyLineHeight              = 1.375f;
     data.captionLineHeight           = 1.5f;
-    data.textFont                    = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Regular.ttf", 18, NULL, 0);
-    data.textFontItalic              = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Italic.ttf", 18, NULL, 0);
-    data.textFontBold                = LoadFontEx("resource/fonts/Inter/static/Inter_24pt-SemiBold.ttf", 24, NULL, 0);
-    data.textFontBoldItalic          = LoadFontEx("resource/fonts/Inter/static/Inter_24pt-SemiBoldItalic.ttf", 24, NULL, 0);
-    data.textFontLight               = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Light.ttf", 14, NULL, 0);
-    data.textFontLightItalic         = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-LightItalic.ttf", 14, NULL, 0);
+    data.textFont                    = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Regular.ttf", 18);
+    data.textFontItalic              = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Italic.ttf", 18);
+    data.textFontBold                = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_24pt-SemiBold.ttf", 24);
+    data.textFontBoldItalic          = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_24pt-SemiBoldItalic.ttf", 24);
+    data.textFontLight               = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Light.ttf", 14);
+    data.textFontLightItalic         = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-LightItalic.ttf", 14);
     data.backlayerRadii              = (Vector4) { 20.0f, 20.0f, 20.0f, 20.0f };
     data.midlayerRadii               = (Vector4) { 15.0f, 15.0f, 15.0f, 15.0f };
     data.frontlayerRadii             = (Vector4) { 10.0f, 10.0f, 10.0f, 10.0f };
@@ -266,6 +274,7 @@ CguiTheme *CguiCreateCrystallineThemeDarkHighContrast(void)
     data.componentBorderSLA          = (Vector3) { 0.0f, 1.0f, 0.500f };
     data.componentTransitionDuration = 0.25f;
     data.componentTransitionEasing   = CguiEaseInOutQuad;
+    data.componentTransitionSpring   = false;
 
     return CguiCreateCrystallineThemeFromData(data);
 }
@@ -318,12 +327,12 @@ CguiTheme *CguiCreateCrystallineThemeLightHighContrast(void)
     data.headingLineHeight           = 1.25f;
     data.bodyLineHeight              = 1.375f;
     data.captionLineHeight           = 1.5f;
-    data.textFont                    = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Regular.ttf", 18, NULL, 0);
-    data.textFontItalic              = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Italic.ttf", 18, NULL, 0);
-    data.textFontBold                = LoadFontEx("resource/fonts/Inter/static/Inter_24pt-SemiBold.ttf", 24, NULL, 0);
-    data.textFontBoldItalic          = LoadFontEx("resource/fonts/Inter/static/Inter_24pt-SemiBoldItalic.ttf", 24, NULL, 0);
-    data.textFontLight               = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-Light.ttf", 14, NULL, 0);
-    data.textFontLightItalic         = LoadFontEx("resource/fonts/Inter/static/Inter_18pt-LightItalic.ttf", 14, NULL, 0);
+    data.textFont                    = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Regular.ttf", 18);
+    data.textFontItalic              = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Italic.ttf", 18);
+    data.textFontBold                = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_24pt-SemiBold.ttf", 24);
+    data.textFontBoldItalic          = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_24pt-SemiBoldItalic.ttf", 24);
+    data.textFontLight               = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-Light.ttf", 14);
+    data.textFontLightItalic         = CguiLoadCrystallineFont("resource/fonts/Inter/static/Inter_18pt-LightItalic.ttf", 14);
     data.backlayerRadii              = (Vector4) { 20.0f, 20.0f, 20.0f, 20.0f };
     data.midlayerRadii               = (Vector4) { 15.0f, 15.0f, 15.0f, 15.0f };
     data.frontlayerRadii             = (Vector4) { 10.0f, 10.0f, 10.0f, 10.0f };
@@ -342,6 +351,7 @@ CguiTheme *CguiCreateCrystallineThemeLightHighContrast(void)
     data.componentBorderSLA          = (Vector3) { 0.0f, 0.0f, 0.500f };
     data.componentTransitionDuration = 0.25f;
     data.componentTransitionEasing   = CguiEaseInOutQuad;
+    data.componentTransitionSpring   = false;
 
     return CguiCreateCrystallineThemeFromData(data);
 }
@@ -555,6 +565,7 @@ static void CguiCreateButtonTheme(CguiTheme *theme, CguiCrystallineThemeData dat
 
     buttonData->transitionDuration = data.componentTransitionDuration;
     buttonData->transitionEasing   = data.componentTransitionEasing;
+    buttonData->transitionSpring   = data.componentTransitionSpring;
 
     CguiBoxElementData boxData;
 
@@ -705,6 +716,7 @@ static void CguiCreateToggleTheme(CguiTheme *theme, CguiCrystallineThemeData dat
 
     toggleData->transitionDuration = data.componentTransitionDuration;
     toggleData->transitionEasing   = data.componentTransitionEasing;
+    toggleData->transitionSpring   = data.componentTransitionSpring;
 
     CguiBoxElementData boxData;
 
@@ -0,0 +1,468 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This source file contains implementations for draw commands.
+///
+/// This project is licensed under the terms of MIT license.
+
+#include <string.h>
+
+#include "crystalgui/crystalgui.h"
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+extern Shader        cguiBoxShader;
+extern CguiDrawList *cguiActiveDrawList;
+
+// Number of latest batches a command is checked against while sorting
+#ifndef CGUI_DRAW_SORT_WINDOW
+#define CGUI_DRAW_SORT_WINDOW 32
+#endif
+
+// Commands with the same state, in recorded order
+struct CguiDrawBatch {
+    int       first;  // First command index
+    int       last;   // Last command index
+    Rectangle bounds; // Area drawn to by all the commands
+};
+
+typedef struct CguiDrawBatch CguiDrawBatch;
+
+CguiDrawList *CguiCreateDrawList(void)
+{
+    return CG_MALLOC_NULL(sizeof(CguiDrawList));
+}
+
+void CguiDeleteDrawList(CguiDrawList *list)
+{
+    if (!list)
+    {
+        return;
+    }
+
+    if (cguiActiveDrawList == list)
+    {
+        cguiActiveDrawList = NULL;
+    }
+
+    CG_FREE_NULL(list->commands);
+    CG_FREE_NULL(list->sorted);
+    CG_FREE_NULL(list->batches);
+    CG_FREE_NULL(list->links);
+    CG_FREE_NULL(list);
+}
+
+void CguiClearDrawList(CguiDrawList *list)
+{
+    if (!list)
+    {
+        return;
+    }
+
+    list->commandsCount = 0;
+}
+
+bool CguiRecordDrawCommand(CguiDrawList *list, CguiDrawCommand command)
+{
+    if (!list)
+    {
+        return false;
+    }
+
+    // Resize capacity if full
+    if (list->commandsCount == list->commandsCapacity)
+    {
+        int              newCapacity = (list->commandsCapacity == 0) ? 64 : (list->commandsCapacity * 2);
+        CguiDrawCommand *newCommands = CG_REALLOC(list->commands, sizeof(CguiDrawCommand) * newCapacity);
+        if (!newCommands)
+        {
+            CG_LOG_ERROR("Failed to grow draw list to %d commands", newCapacity);
+            return false;
+        }
+
+        list->commands         = newCommands;
+        list->commandsCapacity = newCapacity;
+    }
+
+    list->commands[list->commandsCount++] = command;
+
+    return true;
+}
+
+void CguiBeginDrawList(CguiDrawList *list)
+{
+    cguiActiveDrawList = list;
+}
+
+void CguiEndDrawList(void)
+{
+    cguiActiveDrawList = NULL;
+}
+
+// Whether commands are not allowed to move across the command
+static bool CguiIsDrawCommandBarrier(const CguiDrawCommand *command)
+{
+    return command->type == CGUI_DRAW_COMMAND_TYPE_SCISSOR_BEGIN ||
+           command->type == CGUI_DRAW_COMMAND_TYPE_SCISSOR_END ||
+           command->type == CGUI_DRAW_COMMAND_TYPE_CALLBACK;
+}
+
+// Whether the commands are submitted without changing shader or texture in between
+static bool CguiIsDrawCommandStateEqual(const CguiDrawCommand *a, const CguiDrawCommand *b)
+{
+    if (a->type != b->type || CguiIsDrawCommandBarrier(a))
+    {
+        return false;
+    }
+
+    return a->type != CGUI_DRAW_COMMAND_TYPE_TEXTURE || a->data.texture.texture.id == b->data.texture.texture.id;
+}
+
+static bool CguiReserveDrawListScratch(CguiDrawList *list)
+{
+    // Same capacity as the commands, the buffers are swapped after sorting
+    if (list->scratchCapacity == list->commandsCapacity)
+    {
+        return true;
+    }
+
+    int              newCapacity = list->commandsCapacity;
+    CguiDrawCommand *newSorted   = CG_REALLOC(list->sorted, sizeof(CguiDrawCommand) * newCapacity);
+    if (!newSorted)
+    {
+        return false;
+    }
+    list->sorted = newSorted;
+
+    CguiDrawBatch *newBatches = CG_REALLOC(list->batches, sizeof(CguiDrawBatch) * newCapacity);
+    if (!newBatches)
+    {
+        return false;
+    }
+    list->batches = newBatches;
+
+    int *newLinks = CG_REALLOC(list->links, sizeof(int) * newCapacity);
+    if (!newLinks)
+    {
+        return false;
+    }
+    list->links = newLinks;
+
+    list->scratchCapacity = newCapacity;
+
+    return true;
+}
+
+void CguiSortDrawList(CguiDrawList *list)
+{
+    if (!list || list->commandsCount < 2)
+    {
+        return;
+    }
+
+    // Unsorted list is still valid to submit
+    if (!CguiReserveDrawListScratch(list))
+    {
+        CG_LOG_ERROR("Failed to allocate sorting buffers for %d draw commands", list->commandsCount);
+        return;
+    }
+
+    CguiDrawBatch *batches      = list->batches;
+    int           *links        = list->links;
+    int            batchesCount = 0;
+    int            sortedCount  = 0;
+
+    for (int i = 0; i <= list->commandsCount; i++)
+    {
+        // Submit the batches of the segment in order at barriers and at the end
+        if (i == list->commandsCount || CguiIsDrawCommandBarrier(&list->commands[i]))
+        {
+            for (int j = 0; j < batchesCount; j++)
+            {
+                for (int k = batches[j].first; k != -1; k = links[k])
+                {
+                    list->sorted[sortedCount++] = list->commands[k];
+                }
+            }
+
+            batchesCount = 0;
+            if (i < list->commandsCount) list->sorted[sortedCount++] = list->commands[i];
+            continue;
+        }
+
+        CguiDrawCommand *command = &list->commands[i];
+        int              target  = -1;
+
+        // Join the latest batch with the same state, unless the command overlaps a batch drawn after it
+        for (int j = batchesCount - 1; j >= 0 && j >= batchesCount - CGUI_DRAW_SORT_WINDOW; j--)
+        {
+            if (CguiIsDrawCommandStateEqual(&list->commands[batches[j].last], command))
+            {
+                target = j;
+                break;
+            }
+
+            if (CheckCollisionRecs(batches[j].bounds, command->bounds))
+            {
+                break;
+            }
+        }
+
+        links[i] = -1;
+
+        if (target == -1)
+        {
+            batches[batchesCount++] = (CguiDrawBatch) { .first = i, .last = i, .bounds = command->bounds };
+            continue;
+        }
+
+        links[batches[target].last] = i;
+        batches[target].last        = i;
+        batches[target].bounds      = CguiGetRectangleUnion(batches[target].bounds, command->bounds);
+    }
+
+    // Swap buffers
+    CguiDrawCommand *commands = list->commands;
+    list->commands            = list->sorted;
+    list->sorted              = commands;
+}
+
+// Set box shader values of the command
+static void CguiSetBoxShaderValues(const CguiDrawCommand *command)
+{
+    const CguiBoxElementData *data = &command->data.box;
+
+    // Set additional textures
+    // Raylib doesn't have SHADER_UNIFORM_BOOL ... ???
+
+    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "useTexture"), (int[1]) { IsTextureValid(data->texture) }, SHADER_UNIFORM_INT);
+
+    if (IsTextureValid(data->shadowTexture))
+    {
+        SetShaderValueTexture(cguiBoxShader, GetShaderLocation(cguiBoxShader, "texture1"), data->shadowTexture);
+        SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "useShadowTexture"), (int[1]) { 1 }, SHADER_UNIFORM_INT);
+    }
+    else
+    {
+        SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "useShadowTexture"), (int[1]) { 0 }, SHADER_UNIFORM_INT);
+    }
+    if (IsTextureValid(data->borderTexture))
+    {
+        SetShaderValueTexture(cguiBoxShader, GetShaderLocation(cguiBoxShader, "texture2"), data->borderTexture);
+        SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "useBorderTexture"), (int[1]) { 1 }, SHADER_UNIFORM_INT);
+    }
+    else
+    {
+        SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "useBorderTexture"), (int[1]) { 0 }, SHADER_UNIFORM_INT);
+    }
+
+    // Flip Y for shader rectangle
+    Rectangle bounds = command->dest;
+    bounds           = CguiFlipRectangleY(bounds, GetScreenHeight() / 2.0f);
+
+    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "rectangle"), &bounds, SHADER_UNIFORM_VEC4);
+
+    // Set other node valeus
+    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "radii"), &data->radii, SHADER_UNIFORM_VEC4);
+
+    Vector4 colorN = ColorNormalize(data->color);
+    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "color"), &colorN, SHADER_UNIFORM_VEC4);
+
+    // Set shadow values
+    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "shadowDistance"), &data->shadowDistance, SHADER_UNIFORM_FLOAT);
+
+    Vector2 shadowOffset = { data->shadowOffset.x, -data->shadowOffset.y };
+    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "shadowOffset"), &shadowOffset, SHADER_UNIFORM_VEC2);
+    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "shadowShrink"), &data->shadowShrink, SHADER_UNIFORM_FLOAT);
+
+    Vector4 shadowColorN = ColorNormalize(data->shadowColor);
+    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "shadowColor"), &shadowColorN, SHADER_UNIFORM_VEC4);
+
+    // Set border values
+    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "borderThickness"), &data->borderThickness, SHADER_UNIFORM_FLOAT);
+
+    Vector4 borderColorN = ColorNormalize(data->borderColor);
+    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "borderColor"), &borderColorN, SHADER_UNIFORM_VEC4);
+}
+
+// Draw the box (box shader must be active)
+static void CguiDrawBoxQuad(const CguiDrawCommand *command)
+{
+    if (IsTextureValid(command->data.box.texture))
+        CguiDrawTextureFullscreen(command->data.box.texture, WHITE);
+    else
+        DrawRectangle(0, 0, CguiGetAppWidth(), CguiGetAppHeight(), WHITE);
+}
+
+void CguiSubmitDrawList(CguiDrawList *list)
+{
+    if (!list)
+    {
+        return;
+    }
+
+    bool boxShader = false;
+
+    for (int i = 0; i < list->commandsCount; i++)
+    {
+        CguiDrawCommand *command = &list->commands[i];
+
+        if (command->type != CGUI_DRAW_COMMAND_TYPE_BOX)
+        {
+            if (boxShader) EndShaderMode();
+            boxShader = false;
+
+            CguiSubmitDrawCommand(*command);
+            continue;
+        }
+
+        // Optimization: Consecutive boxes keep the shader enabled, only
+        // the previous box is flushed before its values are overwritten
+        // Note: Boxes cannot be merged, their values are shader uniforms and
+        // raylib's render batch has no vertex attributes to carry them
+        if (boxShader) rlDrawRenderBatchActive();
+
+        CguiSetBoxShaderValues(command);
+        if (!boxShader) BeginShaderMode(cguiBoxShader);
+        boxShader = true;
+
+        CguiDrawBoxQuad(command);
+    }
+
+    if (boxShader) EndShaderMode();
+}
+
+int CguiGetDrawListBatches(CguiDrawList *list)
+{
+    if (!list)
+    {
+        return 0;
+    }
+
+    // Same batches as CguiSubmitDrawList(), every box is a batch of its own,
+    // other commands are batched until the shader or texture changes
+    int batches = 0;
+    for (int i = 0; i < list->commandsCount; i++)
+    {
+        CguiDrawCommand *command = &list->commands[i];
+        if (CguiIsDrawCommandBarrier(command))
+        {
+            continue;
+        }
+
+        if (command->type == CGUI_DRAW_COMMAND_TYPE_BOX || i == 0 || !CguiIsDrawCommandStateEqual(&list->commands[i - 1], command))
+        {
+            batches++;
+        }
+    }
+
+    return batches;
+}
+
+int CguiGetDrawListStateChanges(CguiDrawList *list)
+{
+    if (!list)
+    {
+        return 0;
+    }
+
+    int changes = 0;
+    for (int i = 0; i < list->commandsCount; i++)
+    {
+        if (i == 0 || !CguiIsDrawCommandStateEqual(&list->commands[i - 1], &list->commands[i]))
+        {
+            changes++;
+        }
+    }
+
+    return changes;
+}
+
+void CguiSubmitDrawCommand(CguiDrawCommand command)
+{
+    switch (command.type)
+    {
+        case CGUI_DRAW_COMMAND_TYPE_RECTANGLE:
+            DrawRectangleRec(command.dest, command.data.rectangle.color);
+            break;
+        case CGUI_DRAW_COMMAND_TYPE_TEXTURE:
+            DrawTexturePro(command.data.texture.texture, command.data.texture.source, command.dest, command.data.texture.origin, command.data.texture.rotation, command.data.texture.tint);
+            break;
+        case CGUI_DRAW_COMMAND_TYPE_BOX:
+            CguiSetBoxShaderValues(&command);
+            BeginShaderMode(cguiBoxShader);
+            CguiDrawBoxQuad(&command);
+            EndShaderMode();
+            break;
+        case CGUI_DRAW_COMMAND_TYPE_SCISSOR_BEGIN:
+            CguiBeginScissorModeRec(command.bounds);
+            break;
+        case CGUI_DRAW_COMMAND_TYPE_SCISSOR_END:
+            EndScissorMode();
+            break;
+        case CGUI_DRAW_COMMAND_TYPE_CALLBACK:
+            if (command.data.callback.function) command.data.callback.function(command.data.callback.node);
+            break;
+    }
+}
+
+void CguiEmitDrawCommand(CguiDrawCommand command)
+{
+    // Submit right away if recording failed
+    if (!cguiActiveDrawList || !CguiRecordDrawCommand(cguiActiveDrawList, command))
+    {
+        CguiSubmitDrawCommand(command);
+    }
+}
+
+void CguiEmitRectangle(Rectangle rec, Color color)
+{
+    CguiEmitDrawCommand((CguiDrawCommand) { .type = CGUI_DRAW_COMMAND_TYPE_RECTANGLE, .bounds = rec, .dest = rec, .data.rectangle.color = color });
+}
+
+void CguiEmitTexture(Texture texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    CguiEmitDrawCommand((CguiDrawCommand) { .type = CGUI_DRAW_COMMAND_TYPE_TEXTURE, .bounds = CguiGetTextureQuadBounds(dest, origin, rotation), .dest = dest, .data.texture = { texture, source, origin, rotation, tint } });
+}
+
+void CguiEmitTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint)
+{
+    // Same glyph quad as DrawTextCodepoint()
+    int   index       = GetGlyphIndex(font, codepoint);
+    float scaleFactor = fontSize / font.baseSize;
+    float padding     = (float) font.glyphPadding;
+
+    Rectangle source = { font.recs[index].x - padding, font.recs[index].y - padding, font.recs[index].width + 2.0f * padding, font.recs[index].height + 2.0f * padding };
+    Rectangle dest   = { position.x + (font.glyphs[index].offsetX - padding) * scaleFactor, position.y + (font.glyphs[index].offsetY - padding) * scaleFactor, source.width * scaleFactor, source.height * scaleFactor };
+
+    CguiEmitTexture(font.texture, source, dest, Vector2Zero(), 0.0f, tint);
+}
+
+void CguiEmitBox(Rectangle bounds, CguiBoxElementData box)
+{
+    // Edges are anti-aliased up to a pixel outside
+    Rectangle area = CguiGetBoxVisualBounds(bounds, box);
+    area           = (Rectangle) { area.x - 1.0f, area.y - 1.0f, area.width + 2.0f, area.height + 2.0f };
+
+    CguiEmitDrawCommand((CguiDrawCommand) { .type = CGUI_DRAW_COMMAND_TYPE_BOX, .bounds = area, .dest = bounds, .data.box = box });
+}
+
+void CguiEmitScissor(Rectangle area)
+{
+    CguiEmitDrawCommand((CguiDrawCommand) { .type = CGUI_DRAW_COMMAND_TYPE_SCISSOR_BEGIN, .bounds = area });
+}
+
+void CguiEmitScissorEnd(void)
+{
+    CguiEmitDrawCommand((CguiDrawCommand) { .type = CGUI_DRAW_COMMAND_TYPE_SCISSOR_END });
+}
+
+void CguiEmitCallback(CguiNodeFunction function, CguiNode *node)
+{
+    CguiEmitDrawCommand((CguiDrawCommand) { .type = CGUI_DRAW_COMMAND_TYPE_CALLBACK, .data.callback = { function, node } });
+}
@@ -10,9 +10,41 @@
 /// This project is licensed under the terms of MIT license.
 
 #include <math.h>
+#include <stdlib.h>
 
 #include "crystalgui/crystalgui.h"
 
+// Instruction sets for batch easing (define CG_NO_SIMD to use scalar only)
+#ifndef CG_NO_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CGUI_SIMD_SSE2
+#endif
+#if defined(__AVX2__) || (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+#include <immintrin.h>
+#define CGUI_SIMD_AVX2 // Detected at runtime, unless enabled for the whole build
+#endif
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CGUI_SIMD_NEON
+#endif
+#endif // CG_NO_SIMD
+
+// Instruction set used by batch easing
+enum CguiEaseBatchInstructionSet {
+    CGUI_EASE_BATCH_SCALAR, // No SIMD
+    CGUI_EASE_BATCH_SSE2,   // x86 SSE2
+    CGUI_EASE_BATCH_AVX2,   // x86 AVX2
+    CGUI_EASE_BATCH_NEON,   // AArch64 NEON
+};
+
+extern int cguiEaseBatchInstructionSet;
+
+// Number of points between two samples of an easing table to measure its error at
+#ifndef CGUI_EASING_TABLE_ERROR_STEPS
+#define CGUI_EASING_TABLE_ERROR_STEPS 8
+#endif
+
 float CguiEaseLinear(float t)
 {
     return t;
@@ -380,3 +412,298 @@ float CguiEaseInOutBouncePro(float t, float b1, float b2, float b3, float b4, fl
     else
         return (1 + EaseBounce(2 * t - 1, b1, b2, b3, b4, c1, c2, c3, c4)) / 2;
 }
+
+// Sampler of an easing function without user data
+static float CguiSampleEasingFunction(float t, void *userData)
+{
+    return (*(CguiEasingFunction *) userData)(t);
+}
+
+CguiEasingTable *CguiCreateEasingTable(CguiEasingFunction easing, int samplesCount)
+{
+    if (!easing)
+    {
+        return NULL;
+    }
+
+    return CguiCreateEasingTablePro(CguiSampleEasingFunction, &easing, samplesCount);
+}
+
+CguiEasingTable *CguiCreateEasingTablePro(CguiEasingSampler sampler, void *userData, int samplesCount)
+{
+    if (!sampler || samplesCount < 2)
+    {
+        return NULL;
+    }
+
+    CguiEasingTable *table = CG_MALLOC_NULL(sizeof(CguiEasingTable));
+    if (!table)
+    {
+        return NULL;
+    }
+
+    table->samples = CG_MALLOC_NULL(sizeof(float) * samplesCount);
+    if (!table->samples)
+    {
+        CG_FREE_NULL(table);
+        return NULL;
+    }
+
+    table->samplesCount = samplesCount;
+
+    for (int i = 0; i < samplesCount; i++)
+    {
+        table->samples[i] = sampler((float) i / (samplesCount - 1), userData);
+    }
+
+    // Evaluation is exact at the samples, measure in between
+    for (int i = 0; i < samplesCount - 1; i++)
+    {
+        for (int j = 1; j < CGUI_EASING_TABLE_ERROR_STEPS; j++)
+        {
+            float t     = (i + (float) j / CGUI_EASING_TABLE_ERROR_STEPS) / (samplesCount - 1);
+            float error = fabsf(CguiEvalEasingTable(table, t) - sampler(t, userData));
+
+            if (error > table->maxError) table->maxError = error;
+        }
+    }
+
+    return table;
+}
+
+void CguiDeleteEasingTable(CguiEasingTable *table)
+{
+    if (!table)
+    {
+        return;
+    }
+
+    CG_FREE_NULL(table->samples);
+    CG_FREE_NULL(table);
+}
+
+float CguiEvalEasingTable(const CguiEasingTable *table, float t)
+{
+    if (!table)
+    {
+        return t;
+    }
+
+    // Clamped to keep the lookup in the table, NaN evaluates to the first sample
+    if (!(t > 0.0f))
+    {
+        return table->samples[0];
+    }
+
+    float position = t * (table->samplesCount - 1);
+    int   index    = (int) position;
+
+    if (index >= table->samplesCount - 1)
+    {
+        return table->samples[table->samplesCount - 1];
+    }
+
+    float fraction = position - index;
+    return table->samples[index] + (table->samples[index + 1] - table->samples[index]) * fraction;
+}
+
+float CguiGetEasingTableError(const CguiEasingTable *table)
+{
+    if (!table)
+    {
+        return 0.0f;
+    }
+
+    return table->maxError;
+}
+
+#ifdef CGUI_SIMD_SSE2
+// Round down (SSE2 has no floor)
+static inline __m128 CguiFloorSse2(__m128 v)
+{
+    __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+    return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, v), _mm_set1_ps(1.0f)));
+}
+
+#define CGUI_V                 __m128
+#define CGUI_V_MASK            __m128
+#define CGUI_V_NAME(name)      name##Sse2
+#define CGUI_V_ATTRIBUTE       /* none */
+#define CGUI_V_WIDTH           4
+#define CGUI_V_LOAD(p)         _mm_loadu_ps(p)
+#define CGUI_V_STORE(p, v)     _mm_storeu_ps(p, v)
+#define CGUI_V_SET(f)          _mm_set1_ps(f)
+#define CGUI_V_ADD(a, b)       _mm_add_ps(a, b)
+#define CGUI_V_SUB(a, b)       _mm_sub_ps(a, b)
+#define CGUI_V_MUL(a, b)       _mm_mul_ps(a, b)
+#define CGUI_V_MIN(a, b)       _mm_min_ps(a, b)
+#define CGUI_V_MAX(a, b)       _mm_max_ps(a, b)
+#define CGUI_V_SQRT(v)         _mm_sqrt_ps(v)
+#define CGUI_V_FLOOR(v)        CguiFloorSse2(v)
+#define CGUI_V_LESS(a, b)      _mm_cmplt_ps(a, b)
+#define CGUI_V_SELECT(m, a, b) _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#define CGUI_V_EXP2I(v)        _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(v), _mm_set1_epi32(127)), 23))
+#include "cg_easings_batch.inl"
+#endif // CGUI_SIMD_SSE2
+
+#ifdef CGUI_SIMD_AVX2
+#if defined(__GNUC__) && !defined(__AVX2__)
+#define CGUI_V_ATTRIBUTE __attribute__((target("avx2")))
+#else
+#define CGUI_V_ATTRIBUTE /* none */
+#endif
+#define CGUI_V                 __m256
+#define CGUI_V_MASK            __m256
+#define CGUI_V_NAME(name)      name##Avx2
+#define CGUI_V_WIDTH           8
+#define CGUI_V_LOAD(p)         _mm256_loadu_ps(p)
+#define CGUI_V_STORE(p, v)     _mm256_storeu_ps(p, v)
+#define CGUI_V_SET(f)          _mm256_set1_ps(f)
+#define CGUI_V_ADD(a, b)       _mm256_add_ps(a, b)
+#define CGUI_V_SUB(a, b)       _mm256_sub_ps(a, b)
+#define CGUI_V_MUL(a, b)       _mm256_mul_ps(a, b)
+#define CGUI_V_MIN(a, b)       _mm256_min_ps(a, b)
+#define CGUI_V_MAX(a, b)       _mm256_max_ps(a, b)
+#define CGUI_V_SQRT(v)         _mm256_sqrt_ps(v)
+#define CGUI_V_FLOOR(v)        _mm256_floor_ps(v)
+#define CGUI_V_LESS(a, b)      _mm256_cmp_ps(a, b, _CMP_LT_OQ)
+#define CGUI_V_SELECT(m, a, b) _mm256_blendv_ps(b, a, m)
+#define CGUI_V_EXP2I(v)        _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(v), _mm256_set1_epi32(127)), 23))
+#include "cg_easings_batch.inl"
+#endif // CGUI_SIMD_AVX2
+
+#ifdef CGUI_SIMD_NEON
+#define CGUI_V                 float32x4_t
+#define CGUI_V_MASK            uint32x4_t
+#define CGUI_V_NAME(name)      name##Neon
+#define CGUI_V_ATTRIBUTE       /* none */
+#define CGUI_V_WIDTH           4
+#define CGUI_V_LOAD(p)         vld1q_f32(p)
+#define CGUI_V_STORE(p, v)     vst1q_f32(p, v)
+#define CGUI_V_SET(f)          vdupq_n_f32(f)
+#define CGUI_V_ADD(a, b)       vaddq_f32(a, b)
+#define CGUI_V_SUB(a, b)       vsubq_f32(a, b)
+#define CGUI_V_MUL(a, b)       vmulq_f32(a, b)
+#define CGUI_V_MIN(a, b)       vminq_f32(a, b)
+#define CGUI_V_MAX(a, b)       vmaxq_f32(a, b)
+#define CGUI_V_SQRT(v)         vsqrtq_f32(v)
+#define CGUI_V_FLOOR(v)        vrndmq_f32(v)
+#define CGUI_V_LESS(a, b)      vcltq_f32(a, b)
+#define CGUI_V_SELECT(m, a, b) vbslq_f32(m, a, b)
+#define CGUI_V_EXP2I(v)        vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(v), vdupq_n_s32(127)), 23))
+#include "cg_easings_batch.inl"
+#endif // CGUI_SIMD_NEON
+
+// Easing functions of each kind
+static const CguiEasingFunction cguiEasingFunctions[CGUI_EASING_MAX] = {
+    CguiEaseLinear,
+    CguiEaseInQuad, CguiEaseOutQuad, CguiEaseInOutQuad,
+    CguiEaseInCubic, CguiEaseOutCubic, CguiEaseInOutCubic,
+    CguiEaseInQuart, CguiEaseOutQuart, CguiEaseInOutQuart,
+    CguiEaseInQuint, CguiEaseOutQuint, CguiEaseInOutQuint,
+    CguiEaseInSextic, CguiEaseOutSextic, CguiEaseInOutSextic,
+    CguiEaseInSeptic, CguiEaseOutSeptic, CguiEaseInOutSeptic,
+    CguiEaseInOctic, CguiEaseOutOctic, CguiEaseInOutOctic,
+    CguiEaseInNonic, CguiEaseOutNonic, CguiEaseInOutNonic,
+    CguiEaseInSine, CguiEaseOutSine, CguiEaseInOutSine,
+    CguiEaseInExpo, CguiEaseOutExpo, CguiEaseInOutExpo,
+    CguiEaseInCirc, CguiEaseOutCirc, CguiEaseInOutCirc,
+    CguiEaseInBack, CguiEaseOutBack, CguiEaseInOutBack,
+    CguiEaseInElastic, CguiEaseOutElastic, CguiEaseInOutElastic,
+    CguiEaseInBounce, CguiEaseOutBounce, CguiEaseInOutBounce,
+};
+
+CguiEasingFunction CguiGetEasingFunction(int kind)
+{
+    if (kind < 0 || kind >= CGUI_EASING_MAX)
+    {
+        return NULL;
+    }
+
+    return cguiEasingFunctions[kind];
+}
+
+// Detect the best instruction set supported by the CPU
+static int CguiDetectEaseBatchInstructionSet(void)
+{
+#if defined(CGUI_SIMD_AVX2) && defined(__AVX2__)
+    return CGUI_EASE_BATCH_AVX2;
+#elif defined(CGUI_SIMD_AVX2)
+    if (__builtin_cpu_supports("avx2")) return CGUI_EASE_BATCH_AVX2;
+#endif
+
+#if defined(CGUI_SIMD_SSE2)
+    return CGUI_EASE_BATCH_SSE2;
+#elif defined(CGUI_SIMD_NEON)
+    return CGUI_EASE_BATCH_NEON;
+#else
+    return CGUI_EASE_BATCH_SCALAR;
+#endif
+}
+
+void CguiEaseBatch(int kind, const float *t, float *out, int count)
+{
+    CguiEasingFunction easing = CguiGetEasingFunction(kind);
+    if (!easing || !t || !out)
+    {
+        return;
+    }
+
+    if (cguiEaseBatchInstructionSet == -1)
+    {
+        cguiEaseBatchInstructionSet = CguiDetectEaseBatchInstructionSet();
+    }
+
+    int i = 0;
+
+    // Elastic easings are not vectorized
+    if (kind < CGUI_EASING_IN_ELASTIC || kind > CGUI_EASING_IN_OUT_ELASTIC)
+    {
+        switch (cguiEaseBatchInstructionSet)
+        {
+#ifdef CGUI_SIMD_AVX2
+            case CGUI_EASE_BATCH_AVX2:
+                i = CguiEaseBatchAvx2(kind, t, out, count);
+                break;
+#endif
+#ifdef CGUI_SIMD_SSE2
+            case CGUI_EASE_BATCH_SSE2:
+                i = CguiEaseBatchSse2(kind, t, out, count);
+                break;
+#endif
+#ifdef CGUI_SIMD_NEON
+            case CGUI_EASE_BATCH_NEON:
+                i = CguiEaseBatchNeon(kind, t, out, count);
+                break;
+#endif
+            default:
+                break;
+        }
+    }
+
+    // Remaining (or all, without SIMD)
+    for (; i < count; i++)
+    {
+        out[i] = easing(t[i]);
+    }
+}
+
+const char *CguiGetEaseBatchInstructionSet(void)
+{
+    if (cguiEaseBatchInstructionSet == -1)
+    {
+        cguiEaseBatchInstructionSet = CguiDetectEaseBatchInstructionSet();
+    }
+
+    switch (cguiEaseBatchInstructionSet)
+    {
+        case CGUI_EASE_BATCH_SSE2:
+            return "SSE2";
+        case CGUI_EASE_BATCH_AVX2:
+            return "AVX2";
+        case CGUI_EASE_BATCH_NEON:
+            return "NEON";
+        default:
+            return "Scalar";
+    }
+}
@@ -0,0 +1,222 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This source file contains the batch easing kernel. It is included by
+/// cg_easings.c once per instruction set, with the vector operations defined.
+///
+/// This project is licensed under the terms of MIT license.
+
+// Vector operations to define before including:
+// - CGUI_V, CGUI_V_MASK: Vector of floats and mask of a comparison.
+// - CGUI_V_NAME(name): Name suffixed with the instruction set.
+// - CGUI_V_ATTRIBUTE: Attributes of the functions (e.g., target).
+// - CGUI_V_WIDTH: Number of floats in a vector.
+// - CGUI_V_LOAD(p), CGUI_V_STORE(p, v), CGUI_V_SET(f): Unaligned load, store and broadcast.
+// - CGUI_V_ADD(a, b), CGUI_V_SUB(a, b), CGUI_V_MUL(a, b), CGUI_V_MIN(a, b), CGUI_V_MAX(a, b).
+// - CGUI_V_SQRT(v), CGUI_V_FLOOR(v): Square root and round down.
+// - CGUI_V_LESS(a, b): Mask of a < b.
+// - CGUI_V_SELECT(m, a, b): a where the mask is set, b otherwise.
+// - CGUI_V_EXP2I(v): 2 to the power of v, v must be integral in the range [-126..127].
+
+// x to the power of a positive integer
+CGUI_V_ATTRIBUTE static CGUI_V CGUI_V_NAME(CguiPowV)(CGUI_V x, int power)
+{
+    CGUI_V result = x;
+    for (int i = 1; i < power; i++)
+    {
+        result = CGUI_V_MUL(result, x);
+    }
+    return result;
+}
+
+// Cosine of x in the range [0..PI]
+CGUI_V_ATTRIBUTE static CGUI_V CGUI_V_NAME(CguiCosV)(CGUI_V x)
+{
+    // cos(x) = -cos(PI - x), keeps the series in the range [0..PI/2]
+    CGUI_V_MASK upper = CGUI_V_LESS(CGUI_V_SET(PI / 2), x);
+    CGUI_V      y     = CGUI_V_SELECT(upper, CGUI_V_SUB(CGUI_V_SET(PI), x), x);
+    CGUI_V      y2    = CGUI_V_MUL(y, y);
+
+    // Taylor series up to y^12 (error below 1e-8)
+    CGUI_V c = CGUI_V_SET(1.0f / 479001600.0f);
+    c        = CGUI_V_ADD(CGUI_V_MUL(c, y2), CGUI_V_SET(-1.0f / 3628800.0f));
+    c        = CGUI_V_ADD(CGUI_V_MUL(c, y2), CGUI_V_SET(1.0f / 40320.0f));
+    c        = CGUI_V_ADD(CGUI_V_MUL(c, y2), CGUI_V_SET(-1.0f / 720.0f));
+    c        = CGUI_V_ADD(CGUI_V_MUL(c, y2), CGUI_V_SET(1.0f / 24.0f));
+    c        = CGUI_V_ADD(CGUI_V_MUL(c, y2), CGUI_V_SET(-1.0f / 2.0f));
+    c        = CGUI_V_ADD(CGUI_V_MUL(c, y2), CGUI_V_SET(1.0f));
+
+    return CGUI_V_SELECT(upper, CGUI_V_SUB(CGUI_V_SET(0.0f), c), c);
+}
+
+// 2 to the power of x
+CGUI_V_ATTRIBUTE static CGUI_V CGUI_V_NAME(CguiExp2V)(CGUI_V x)
+{
+    x = CGUI_V_MIN(CGUI_V_MAX(x, CGUI_V_SET(-126.0f)), CGUI_V_SET(127.0f));
+
+    // 2^x = 2^n * 2^f, with f in the range [-0.5..0.5] (polynomial from Cephes' exp2f)
+    CGUI_V n = CGUI_V_FLOOR(CGUI_V_ADD(x, CGUI_V_SET(0.5f)));
+    CGUI_V f = CGUI_V_SUB(x, n);
+
+    CGUI_V p = CGUI_V_SET(1.535336188319500e-4f);
+    p        = CGUI_V_ADD(CGUI_V_MUL(p, f), CGUI_V_SET(1.339887440266574e-3f));
+    p        = CGUI_V_ADD(CGUI_V_MUL(p, f), CGUI_V_SET(9.618437357674640e-3f));
+    p        = CGUI_V_ADD(CGUI_V_MUL(p, f), CGUI_V_SET(5.550332471162809e-2f));
+    p        = CGUI_V_ADD(CGUI_V_MUL(p, f), CGUI_V_SET(2.402264791363012e-1f));
+    p        = CGUI_V_ADD(CGUI_V_MUL(p, f), CGUI_V_SET(6.931472028550421e-1f));
+    p        = CGUI_V_ADD(CGUI_V_MUL(p, f), CGUI_V_SET(1.0f));
+
+    return CGUI_V_MUL(p, CGUI_V_EXP2I(n));
+}
+
+// Same as EaseBounce with the default parameters
+CGUI_V_ATTRIBUTE static CGUI_V CGUI_V_NAME(CguiBounceV)(CGUI_V t)
+{
+    const float b1 = 4.f / 11, b2 = 8.f / 11, b3 = 9.f / 10, b4 = 21.f / 22;
+    const float c1 = 121.f / 16, c2 = 363.f / 40, c3 = 4356.f / 361, c4 = 54.f / 5;
+
+    CGUI_V d1 = t;
+    CGUI_V d2 = CGUI_V_SUB(t, CGUI_V_SET(b3));
+    CGUI_V d3 = CGUI_V_SUB(t, CGUI_V_SET(b4));
+    CGUI_V d4 = CGUI_V_SUB(t, CGUI_V_SET(1.0f));
+
+    // Reverse order of the branches, so the first matching branch wins
+    CGUI_V result = CGUI_V_ADD(CGUI_V_MUL(CGUI_V_MUL(CGUI_V_SET(c4), d4), d4), CGUI_V_SET(1.0f));
+    result        = CGUI_V_SELECT(CGUI_V_LESS(t, CGUI_V_SET(b3)), CGUI_V_ADD(CGUI_V_MUL(CGUI_V_MUL(CGUI_V_SET(c3), d3), d3), CGUI_V_SET(b4)), result);
+    result        = CGUI_V_SELECT(CGUI_V_LESS(t, CGUI_V_SET(b2)), CGUI_V_ADD(CGUI_V_MUL(CGUI_V_MUL(CGUI_V_SET(c2), d2), d2), CGUI_V_SET(b4)), result);
+    result        = CGUI_V_SELECT(CGUI_V_LESS(t, CGUI_V_SET(b1)), CGUI_V_MUL(CGUI_V_MUL(CGUI_V_SET(c1), d1), d1), result);
+    return result;
+}
+
+// Back easing in with the overshoot
+CGUI_V_ATTRIBUTE static CGUI_V CGUI_V_NAME(CguiBackV)(CGUI_V t, float overshoot)
+{
+    return CGUI_V_MUL(CGUI_V_MUL(t, t), CGUI_V_SUB(CGUI_V_MUL(CGUI_V_SET(overshoot + 1), t), CGUI_V_SET(overshoot)));
+}
+
+// Ease a vector of t, the kind must be vectorized
+CGUI_V_ATTRIBUTE static CGUI_V CGUI_V_NAME(CguiEaseV)(int kind, CGUI_V t)
+{
+    const CGUI_V one  = CGUI_V_SET(1.0f);
+    const CGUI_V half = CGUI_V_SET(0.5f);
+    const CGUI_V two  = CGUI_V_SET(2.0f);
+
+    // In-out easings are split at the half
+    CGUI_V_MASK lower = CGUI_V_LESS(t, half);
+
+    // Polynomial families are ordered by power
+    if (kind >= CGUI_EASING_IN_QUAD && kind <= CGUI_EASING_IN_OUT_NONIC)
+    {
+        int power = (kind - CGUI_EASING_IN_QUAD) / 3 + 2;
+
+        switch ((kind - CGUI_EASING_IN_QUAD) % 3)
+        {
+            case 0:
+                return CGUI_V_NAME(CguiPowV)(t, power);
+            case 1:
+                return CGUI_V_SUB(one, CGUI_V_NAME(CguiPowV)(CGUI_V_SUB(one, t), power));
+            default:
+                return CGUI_V_SELECT(lower,
+                                     CGUI_V_MUL(CGUI_V_NAME(CguiPowV)(CGUI_V_MUL(two, t), power), half),
+                                     CGUI_V_SUB(one, CGUI_V_MUL(CGUI_V_NAME(CguiPowV)(CGUI_V_MUL(two, CGUI_V_SUB(one, t)), power), half)));
+        }
+    }
+
+    switch (kind)
+    {
+        case CGUI_EASING_IN_SINE:
+            return CGUI_V_SUB(one, CGUI_V_NAME(CguiCosV)(CGUI_V_MUL(t, CGUI_V_SET(PI / 2))));
+        case CGUI_EASING_OUT_SINE:
+            return CGUI_V_NAME(CguiCosV)(CGUI_V_MUL(CGUI_V_SUB(one, t), CGUI_V_SET(PI / 2)));
+        case CGUI_EASING_IN_OUT_SINE:
+            return CGUI_V_MUL(CGUI_V_SUB(one, CGUI_V_NAME(CguiCosV)(CGUI_V_MUL(t, CGUI_V_SET(PI)))), half);
+
+        case CGUI_EASING_IN_EXPO:
+            return CGUI_V_NAME(CguiExp2V)(CGUI_V_MUL(CGUI_V_SET(10.0f), CGUI_V_SUB(t, one)));
+        case CGUI_EASING_OUT_EXPO:
+            return CGUI_V_SUB(one, CGUI_V_NAME(CguiExp2V)(CGUI_V_MUL(CGUI_V_SET(-10.0f), t)));
+        case CGUI_EASING_IN_OUT_EXPO: {
+            // Divided by 2^10 as in CguiEaseInOutExpoPro
+            CGUI_V x = CGUI_V_MUL(CGUI_V_SET(10.0f), CGUI_V_SUB(CGUI_V_MUL(two, t), one));
+            return CGUI_V_SELECT(lower,
+                                 CGUI_V_NAME(CguiExp2V)(CGUI_V_SUB(x, CGUI_V_SET(10.0f))),
+                                 CGUI_V_SUB(one, CGUI_V_NAME(CguiExp2V)(CGUI_V_SUB(CGUI_V_SUB(CGUI_V_SET(0.0f), x), CGUI_V_SET(10.0f)))));
+        }
+
+        case CGUI_EASING_IN_CIRC:
+            return CGUI_V_SUB(one, CGUI_V_SQRT(CGUI_V_SUB(one, CGUI_V_MUL(t, t))));
+        case CGUI_EASING_OUT_CIRC: {
+            CGUI_V d = CGUI_V_SUB(t, one);
+            return CGUI_V_SQRT(CGUI_V_SUB(one, CGUI_V_MUL(d, d)));
+        }
+        case CGUI_EASING_IN_OUT_CIRC: {
+            // Square roots of the unselected half may be NaN
+            CGUI_V d = CGUI_V_SUB(two, CGUI_V_MUL(two, t));
+            return CGUI_V_SELECT(lower,
+                                 CGUI_V_MUL(CGUI_V_SUB(one, CGUI_V_SQRT(CGUI_V_SUB(one, CGUI_V_MUL(CGUI_V_SET(4.0f), CGUI_V_MUL(t, t))))), half),
+                                 CGUI_V_MUL(CGUI_V_ADD(CGUI_V_SQRT(CGUI_V_SUB(one, CGUI_V_MUL(d, d))), one), half));
+        }
+
+        case CGUI_EASING_IN_BACK:
+            return CGUI_V_NAME(CguiBackV)(t, 1.70158f);
+        case CGUI_EASING_OUT_BACK:
+            return CGUI_V_SUB(one, CGUI_V_NAME(CguiBackV)(CGUI_V_SUB(one, t), 1.70158f));
+        case CGUI_EASING_IN_OUT_BACK: {
+            const float overshoot = 1.70158 * 1.525;
+
+            CGUI_V lo = CGUI_V_MUL(t, two);
+            CGUI_V hi = CGUI_V_SUB(CGUI_V_MUL(t, two), two);
+            CGUI_V hv = CGUI_V_MUL(CGUI_V_MUL(hi, hi), CGUI_V_ADD(CGUI_V_MUL(CGUI_V_SET(overshoot + 1), hi), CGUI_V_SET(overshoot)));
+            return CGUI_V_SELECT(lower,
+                                 CGUI_V_MUL(CGUI_V_NAME(CguiBackV)(lo, overshoot), half),
+                                 CGUI_V_MUL(CGUI_V_ADD(hv, two), half));
+        }
+
+        case CGUI_EASING_IN_BOUNCE:
+            return CGUI_V_SUB(one, CGUI_V_NAME(CguiBounceV)(CGUI_V_SUB(one, t)));
+        case CGUI_EASING_OUT_BOUNCE:
+            return CGUI_V_NAME(CguiBounceV)(t);
+        case CGUI_EASING_IN_OUT_BOUNCE:
+            return CGUI_V_SELECT(lower,
+                                 CGUI_V_MUL(CGUI_V_SUB(one, CGUI_V_NAME(CguiBounceV)(CGUI_V_SUB(one, CGUI_V_MUL(two, t)))), half),
+                                 CGUI_V_MUL(CGUI_V_ADD(one, CGUI_V_NAME(CguiBounceV)(CGUI_V_SUB(CGUI_V_MUL(two, t), one))), half));
+
+        default:
+            return t;
+    }
+}
+
+// Ease whole vectors of t, returns the number of t eased
+CGUI_V_ATTRIBUTE static int CGUI_V_NAME(CguiEaseBatch)(int kind, const float *t, float *out, int count)
+{
+    int i = 0;
+    for (; i + CGUI_V_WIDTH <= count; i += CGUI_V_WIDTH)
+    {
+        CGUI_V_STORE(&out[i], CGUI_V_NAME(CguiEaseV)(kind, CGUI_V_LOAD(&t[i])));
+    }
+    return i;
+}
+
+// Vector operations are defined again for the next instruction set
+#undef CGUI_V
+#undef CGUI_V_MASK
+#undef CGUI_V_NAME
+#undef CGUI_V_ATTRIBUTE
+#undef CGUI_V_WIDTH
+#undef CGUI_V_LOAD
+#undef CGUI_V_STORE
+#undef CGUI_V_SET
+#undef CGUI_V_ADD
+#undef CGUI_V_SUB
+#undef CGUI_V_MUL
+#undef CGUI_V_MIN
+#undef CGUI_V_MAX
+#undef CGUI_V_SQRT
+#undef CGUI_V_FLOOR
+#undef CGUI_V_LESS
+#undef CGUI_V_SELECT
+#undef CGUI_V_EXP2I
@@ -9,14 +9,14 @@
 ///
 /// This project is licensed under the terms of MIT license.
 
+#include <math.h>
 #include <string.h>
 
 #include "crystalgui/crystalgui.h"
 #include "raylib.h"
 #include "raymath.h"
 
-extern int    cguiNameCounter;
-extern Shader cguiBoxShader;
+extern int cguiNameCounter;
 
 CguiNode *CguiCreateTextElement(const char *text, Color color)
 {
@@ -34,7 +34,8 @@ CguiNode *CguiCreateTextElementPro(const char *text, Font font, float fontSize,
     CguiTextElementData data = { .text = text, .font = font, .fontSize = fontSize, .spacing = spacing, .lineSpacing = lineSpacing, .color = color, .xJustify = xJustify, .yJustify = yJustify };
     memcpy(node->data, &data, sizeof(CguiTextElementData));
 
-    node->drawPre = CguiDrawPreTextElement;
+    node->drawPre      = CguiDrawPreTextElement;
+    node->visualBounds = CguiGetTextElementVisualBounds;
 
     return node;
 }
@@ -52,16 +53,22 @@ void CguiDrawPreTextElement(CguiNode *node)
     CguiDrawTextPro(data->text, data->font, bounds, data->fontSize, data->spacing, data->lineSpacing, data->color, data->xJustify, data->yJustify);
 }
 
+Rectangle CguiGetTextElementVisualBounds(CguiNode *node)
+{
+    if (!node || node->type != CGUI_ELEMENT_NODE_TYPE_TEXT || !node->data)
+    {
+        return CguiGetNodeVisualBounds(NULL);
+    }
+
+    CguiTextElementData *data = node->data;
+
+    // Justified text taller than the bounds is drawn above them
+    return CguiGetTextBounds(data->text, data->font, node->bounds, data->fontSize, data->spacing, data->lineSpacing, data->xJustify, data->yJustify);
+}
+
 bool CguiIsTextElementDataEqual(CguiTextElementData a, CguiTextElementData b)
 {
-    return a.text == b.text &&
-           a.font.texture.id == b.font.texture.id &&
-           a.fontSize == b.fontSize &&
-           a.spacing == b.spacing &&
-           a.lineSpacing == b.lineSpacing &&
-           CguiIsColorEqual(a.color, b.color) &&
-           a.xJustify == b.xJustify &&
-           a.yJustify == b.yJustify;
+    return CguiIsTextElementDataEqualP(&a, &b);
 }
 
 CguiNode *CguiCreateTextureElement(Texture texture)
@@ -80,7 +87,8 @@ CguiNode *CguiCreateTextureElementPro(Texture texture, Rectangle source, Vector2
     CguiTextureElementData data = { .texture = texture, .source = source, .origin = origin, .rotation = rotation, .tint = tint };
     memcpy(node->data, &data, sizeof(CguiTextureElementData));
 
-    node->drawPre = CguiDrawPreTextureElement;
+    node->drawPre      = CguiDrawPreTextureElement;
+    node->visualBounds = CguiGetTextureElementVisualBounds;
 
     return node;
 }
@@ -94,16 +102,25 @@ void CguiDrawPreTextureElement(CguiNode *node)
 
     CguiTextureElementData *data = node->data;
 
-    DrawTexturePro(data->texture, data->source, (Rectangle) { node->bounds.x + data->origin.x, node->bounds.y + data->origin.y, node->bounds.width, node->bounds.height }, data->origin, data->rotation, data->tint);
+    CguiEmitTexture(data->texture, data->source, (Rectangle) { node->bounds.x + data->origin.x, node->bounds.y + data->origin.y, node->bounds.width, node->bounds.height }, data->origin, data->rotation, data->tint);
+}
+
+Rectangle CguiGetTextureElementVisualBounds(CguiNode *node)
+{
+    if (!node || node->type != CGUI_ELEMENT_NODE_TYPE_TEXTURE || !node->data)
+    {
+        return CguiGetNodeVisualBounds(NULL);
+    }
+
+    CguiTextureElementData *data = node->data;
+
+    // Texture is rotated along the origin (offset from the bounds position)
+    return CguiGetTextureQuadBounds((Rectangle) { node->bounds.x + data->origin.x, node->bounds.y + data->origin.y, node->bounds.width, node->bounds.height }, data->origin, data->rotation);
 }
 
 bool CguiIsTextureElementDataEqual(CguiTextureElementData a, CguiTextureElementData b)
 {
-    return a.texture.id == b.texture.id &&
-           CguiIsRectangleEqual(a.source, b.source) &&
-           Vector2Equals(a.origin, b.origin) &&
-           a.rotation == b.rotation &&
-           CguiIsColorEqual(a.tint, b.tint);
+    return CguiIsTextureElementDataEqualP(&a, &b);
 }
 
 CguiNode *CguiCreateBoxElement(float radius, Color color)
@@ -127,7 +144,9 @@ CguiNode *CguiCreateBoxElementPro(Vector4 radii, Color color, Texture texture, f
     CguiBoxElementData data = { .radii = radii, .color = color, .texture = texture, .shadowDistance = shadowDistance, .shadowOffset = shadowOffset, .shadowShrink = shadowShrink, .shadowColor = shadowColor, .shadowTexture = shadowTexture, .borderThickness = borderThickness, .borderColor = borderColor, .borderTexture = borderTexture };
     memcpy(node->data, &data, sizeof(CguiBoxElementData));
 
-    node->drawPre = CguiDrawPreBoxElement;
+    node->drawPre      = CguiDrawPreBoxElement;
+    node->visualBounds = CguiGetBoxElementVisualBounds;
+    node->opaqueBounds = CguiGetBoxElementOpaqueBounds;
 
     return node;
 }
@@ -141,78 +160,65 @@ void CguiDrawPreBoxElement(CguiNode *node)
 
     CguiBoxElementData *data = node->data;
 
-    // Set additional textures
-    // Raylib doesn't have SHADER_UNIFORM_BOOL ... ???
-
-    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "useTexture"), (int[1]) { IsTextureValid(data->texture) }, SHADER_UNIFORM_INT);
+    CguiEmitBox(node->bounds, *data);
+}
 
-    if (IsTextureValid(data->shadowTexture))
+Rectangle CguiGetBoxElementVisualBounds(CguiNode *node)
+{
+    if (!node || node->type != CGUI_ELEMENT_NODE_TYPE_BOX || !node->data)
     {
-        SetShaderValueTexture(cguiBoxShader, GetShaderLocation(cguiBoxShader, "texture1"), data->shadowTexture);
-        SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "useShadowTexture"), (int[1]) { 1 }, SHADER_UNIFORM_INT);
+        return CguiGetNodeVisualBounds(NULL);
     }
-    else
+
+    CguiBoxElementData *data = node->data;
+
+    return CguiGetBoxVisualBounds(node->bounds, *data);
+}
+
+Rectangle CguiGetBoxElementOpaqueBounds(CguiNode *node)
+{
+    if (!node || node->type != CGUI_ELEMENT_NODE_TYPE_BOX || !node->data)
     {
-        SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "useShadowTexture"), (int[1]) { 0 }, SHADER_UNIFORM_INT);
+        return CguiGetNodeOpaqueBounds(NULL);
     }
-    if (IsTextureValid(data->borderTexture))
+
+    CguiBoxElementData *data = node->data;
+
+    // Textures may be translucent
+    if (data->color.a != 255 || IsTextureValid(data->texture))
     {
-        SetShaderValueTexture(cguiBoxShader, GetShaderLocation(cguiBoxShader, "texture2"), data->borderTexture);
-        SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "useBorderTexture"), (int[1]) { 1 }, SHADER_UNIFORM_INT);
+        return CguiGetNodeOpaqueBounds(NULL);
     }
-    else
+
+    if (data->borderThickness > 0.0f && (data->borderColor.a != 255 || IsTextureValid(data->borderTexture)))
     {
-        SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "useBorderTexture"), (int[1]) { 0 }, SHADER_UNIFORM_INT);
+        return CguiGetNodeOpaqueBounds(NULL);
     }
 
-    // Flip Y for shader rectangle
+    // Interior without the rounded corners
+    // Note: The shader rounds every corner by the (scaled) top-left radius, the
+    // largest radius covers it and any per-corner rounding
     Rectangle bounds = node->bounds;
-    bounds           = CguiFlipRectangleY(bounds, GetScreenHeight() / 2.0f);
-
-    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "rectangle"), &bounds, SHADER_UNIFORM_VEC4);
-
-    // Set other node valeus
-    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "radii"), &data->radii, SHADER_UNIFORM_VEC4);
-
-    Vector4 colorN = ColorNormalize(data->color);
-    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "color"), &colorN, SHADER_UNIFORM_VEC4);
-
-    // Set shadow values
-    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "shadowDistance"), &data->shadowDistance, SHADER_UNIFORM_FLOAT);
+    float     inset  = fmaxf(fmaxf(data->radii.x, data->radii.y), fmaxf(data->radii.z, data->radii.w));
 
-    Vector2 shadowOffset = { data->shadowOffset.x, -data->shadowOffset.y };
-    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "shadowOffset"), &shadowOffset, SHADER_UNIFORM_VEC2);
-    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "shadowShrink"), &data->shadowShrink, SHADER_UNIFORM_FLOAT);
-
-    Vector4 shadowColorN = ColorNormalize(data->shadowColor);
-    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "shadowColor"), &shadowColorN, SHADER_UNIFORM_VEC4);
+    return (Rectangle) { bounds.x + inset, bounds.y + inset, fmaxf(bounds.width - inset * 2.0f, 0.0f), fmaxf(bounds.height - inset * 2.0f, 0.0f) };
+}
 
-    // Set border values
-    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "borderThickness"), &data->borderThickness, SHADER_UNIFORM_FLOAT);
+Rectangle CguiGetBoxVisualBounds(Rectangle bounds, CguiBoxElementData data)
+{
+    // Border is drawn inside, only the shadow is drawn outside
+    if (data.shadowDistance <= 0.0f)
+    {
+        return bounds;
+    }
 
-    Vector4 borderColorN = ColorNormalize(data->borderColor);
-    SetShaderValue(cguiBoxShader, GetShaderLocation(cguiBoxShader, "borderColor"), &borderColorN, SHADER_UNIFORM_VEC4);
+    float     extent = data.shadowDistance - data.shadowShrink;
+    Rectangle shadow = { bounds.x + data.shadowOffset.x - extent, bounds.y + data.shadowOffset.y - extent, bounds.width + extent * 2.0f, bounds.height + extent * 2.0f };
 
-    // Draw rectangle
-    BeginShaderMode(cguiBoxShader);
-    if (IsTextureValid(data->texture))
-        CguiDrawTextureFullscreen(data->texture, WHITE);
-    else
-        DrawRectangle(0, 0, CguiGetAppWidth(), CguiGetAppHeight(), WHITE);
-    EndShaderMode();
+    return CguiGetRectangleUnion(bounds, shadow);
 }
 
 bool CguiIsBoxElementDataEqual(CguiBoxElementData a, CguiBoxElementData b)
 {
-    return Vector4Equals(a.radii, b.radii) &&
-           CguiIsColorEqual(a.color, b.color) &&
-           a.texture.id == b.texture.id &&
-           a.shadowDistance == b.shadowDistance &&
-           Vector2Equals(a.shadowOffset, b.shadowOffset) &&
-           a.shadowShrink == b.shadowShrink &&
-           CguiIsColorEqual(a.shadowColor, b.shadowColor) &&
-           a.shadowTexture.id == b.shadowTexture.id &&
-           a.borderThickness == b.borderThickness &&
-           CguiIsColorEqual(a.borderColor, b.borderColor) &&
-           a.borderTexture.id == b.borderTexture.id;
+    return CguiIsBoxElementDataEqualP(&a, &b);
 }
@@ -15,7 +15,7 @@
 #include "raylib.h"
 #include "raymath.h"
 
-extern CguiNode *cguiMouseButtonPressedNode;
+extern CguiNodeHandle cguiMouseButtonPressedNode;
 
 void CguiDispatchEvents(CguiNode *root)
 {
@@ -113,21 +113,26 @@ void CguiDispatchEvents(CguiNode *root)
             {
                 if (cursorHitNode->canHandleMouseEvents && cursorHitNode->handleEvent && cursorHitNode->handleEvent(cursorHitNode, (CguiEvent *) &event))
                 {
-                    cguiMouseButtonPressedNode = cursorHitNode;
+                    cguiMouseButtonPressedNode = CguiGetNodeHandle(cursorHitNode);
                     break;
                 }
                 cursorHitNode = cursorHitNode->parent;
             }
         }
-        if (IsMouseButtonReleased(mouseButton) && cguiMouseButtonPressedNode)
+        if (IsMouseButtonReleased(mouseButton))
         {
-            CguiMouseButtonPressEvent event = {
-                .eventType = CGUI_EVENT_TYPE_MOUSE_BUTTON_RELEASE,
-                .button    = mouseButton
-            };
+            // Pressed node may have been deleted since
+            CguiNode *pressedNode = CguiResolveHandle(cguiMouseButtonPressedNode);
+            if (pressedNode)
+            {
+                CguiMouseButtonPressEvent event = {
+                    .eventType = CGUI_EVENT_TYPE_MOUSE_BUTTON_RELEASE,
+                    .button    = mouseButton
+                };
 
-            cguiMouseButtonPressedNode->handleEvent(cguiMouseButtonPressedNode, (CguiEvent *) &event);
-            cguiMouseButtonPressedNode = NULL;
+                pressedNode->handleEvent(pressedNode, (CguiEvent *) &event);
+                cguiMouseButtonPressedNode = (CguiNodeHandle) { 0 };
+            }
         }
     }
 }
@@ -16,6 +16,12 @@
 #include "raylib.h"
 #include "raymath.h"
 
+extern Rectangle *cguiScissorStack;
+extern int        cguiScissorStackCount;
+extern int        cguiScissorStackCapacity;
+extern int        cguiAppWidthOverride;
+extern int        cguiAppHeightOverride;
+
 // Hotkey
 
 bool CguiIsKeyRepeated(int key)
@@ -63,23 +69,15 @@ bool CguiIsKeyComboReleased(int hotkey, int key)
 
 // Texts
 
-void CguiDrawTextPro(const char *text, Font font, Rectangle bounds, float fontSize, float spacing, float lineSpacing, Color color, int xJustify, int yJustify)
+// Measure the height of the word-wrapped text, and the width of its widest line
+static float CguiMeasureTextLines(const char *text, Font font, float width, float fontSize, float spacing, float lineSpacing, float *maxLineWidth)
 {
-    if (!text)
-    {
-        return;
-    }
+    float scaleFactor = fontSize / font.baseSize;
 
-    if (font.texture.id == 0) font = GetFontDefault();
-
-    const char *textPtr     = text;
-    float       scaleFactor = fontSize / font.baseSize;
-
-    // Pre-pass: count total number of lines and total text height
     int   totalLines      = 0;
     float totalTextHeight = 0;
 
-    const char *measurePtr = textPtr;
+    const char *measurePtr = text;
     while (*measurePtr != '\0')
     {
         const char *lineStart       = measurePtr;
@@ -134,7 +132,7 @@ void CguiDrawTextPro(const char *text, Font font, Rectangle bounds, float fontSi
             {
                 float newLineWidth = (wordsCount == 0) ? wordWidth : lineWidth + spaceWidth + wordWidth;
 
-                if (newLineWidth <= bounds.width)
+                if (newLineWidth <= width)
                 {
                     lineWidth = newLineWidth;
                     lineEnd   = scanPtr;
@@ -162,7 +160,7 @@ void CguiDrawTextPro(const char *text, Font font, Rectangle bounds, float fontSi
 
                             float newWidth = partialWordWidth + glyphAdvance2 + charSpacing2;
 
-                            if (newWidth <= bounds.width)
+                            if (newWidth <= width)
                             {
                                 partialWordWidth = newWidth;
                                 partialWordEnd   = nextPtr2;
@@ -189,6 +187,7 @@ void CguiDrawTextPro(const char *text, Font font, Rectangle bounds, float fontSi
 
         totalLines++;
         totalTextHeight += fontSize + lineSpacing;
+        if (maxLineWidth && lineWidth > *maxLineWidth) *maxLineWidth = lineWidth;
 
         // Key fix: always advance measurePtr, even when line is full
         if (scanPtr > lineStart)
@@ -208,6 +207,30 @@ void CguiDrawTextPro(const char *text, Font font, Rectangle bounds, float fontSi
         totalTextHeight -= lineSpacing;
     }
 
+    return totalTextHeight;
+}
+
+void CguiDrawTextPro(const char *text, Font font, Rectangle bounds, float fontSize, float spacing, float lineSpacing, Color color, int xJustify, int yJustify)
+{
+    if (!text)
+    {
+        return;
+    }
+
+    // Note: The default font is not loaded without a window, fonts for software
+    // rendering have glyphs but may have no GPU texture
+    if (!font.glyphs) font = GetFontDefault();
+    if (!font.glyphs || font.baseSize <= 0)
+    {
+        return;
+    }
+
+    const char *textPtr     = text;
+    float       scaleFactor = fontSize / font.baseSize;
+
+    // Pre-pass: total text height
+    float totalTextHeight = CguiMeasureTextLines(text, font, bounds.width, fontSize, spacing, lineSpacing, NULL);
+
     // Compute starting posY based on yJustify
     float posY = bounds.y;
 
@@ -361,7 +384,7 @@ void CguiDrawTextPro(const char *text, Font font, Rectangle bounds, float fontSi
                 int   glyphIndex   = GetGlyphIndex(font, codepoint);
                 float glyphAdvance = (font.glyphs[glyphIndex].advanceX > 0 ? font.glyphs[glyphIndex].advanceX : font.recs[glyphIndex].width) * scaleFactor;
 
-                DrawTextCodepoint(font, codepoint, (Vector2) { offsetX, posY }, fontSize, color);
+                CguiEmitTextCodepoint(font, codepoint, (Vector2) { offsetX, posY }, fontSize, color);
 
                 offsetX += glyphAdvance + spacing;
                 drawPtr += cpByteCount;
@@ -383,6 +406,48 @@ void CguiDrawTextPro(const char *text, Font font, Rectangle bounds, float fontSi
     }
 }
 
+Rectangle CguiGetTextBounds(const char *text, Font font, Rectangle bounds, float fontSize, float spacing, float lineSpacing, int xJustify, int yJustify)
+{
+    Rectangle textBounds = { bounds.x, bounds.y, 0.0f, 0.0f };
+
+    if (!text)
+    {
+        return textBounds;
+    }
+
+    if (!font.glyphs) font = GetFontDefault();
+    if (!font.glyphs || font.baseSize <= 0)
+    {
+        return textBounds;
+    }
+
+    float maxLineWidth    = 0.0f;
+    float totalTextHeight = CguiMeasureTextLines(text, font, bounds.width, fontSize, spacing, lineSpacing, &maxLineWidth);
+
+    // Same justification as drawing, lines may be above the bounds but are not drawn below them
+    float posY = bounds.y;
+    if (yJustify == CGUI_TEXT_JUSTIFY_CENTER) posY += (bounds.height - totalTextHeight) / 2;
+    else if (yJustify == CGUI_TEXT_JUSTIFY_END) posY += bounds.height - totalTextHeight;
+
+    if (posY + fontSize > bounds.y + bounds.height)
+    {
+        return textBounds;
+    }
+
+    textBounds.y      = posY;
+    textBounds.height = fminf(posY + totalTextHeight, bounds.y + bounds.height) - posY;
+    textBounds.width  = maxLineWidth;
+
+    if (xJustify == CGUI_TEXT_JUSTIFY_CENTER) textBounds.x += (bounds.width - maxLineWidth) / 2;
+    else if (xJustify == CGUI_TEXT_JUSTIFY_END) textBounds.x += bounds.width - maxLineWidth;
+    else if (xJustify == CGUI_TEXT_JUSTIFY_SPACE_BETWEEN) textBounds.width = fmaxf(bounds.width, maxLineWidth);
+
+    // Glyph quads are drawn with their padding around them
+    float padding = font.glyphPadding * fontSize / font.baseSize;
+
+    return (Rectangle) { textBounds.x - padding, textBounds.y - padding, textBounds.width + padding * 2, textBounds.height + padding * 2 };
+}
+
 // Textures
 
 void CguiDrawTextureDest(Texture texture, Rectangle dest, Color tint)
@@ -400,6 +465,37 @@ void CguiDrawTextureFullscreenEx(Texture texture, Rectangle src, Color tint)
     DrawTexturePro(texture, src, CguiGetAppSizeRec(), Vector2Zero(), 0.0f, tint);
 }
 
+Rectangle CguiGetTextureQuadBounds(Rectangle dest, Vector2 origin, float rotation)
+{
+    Rectangle quad = { dest.x - origin.x, dest.y - origin.y, dest.width, dest.height };
+
+    // Optimization: Not rotated
+    if (rotation == 0.0f)
+    {
+        return quad;
+    }
+
+    // Quad is rotated along the destination position
+    Vector2 pivot     = { dest.x, dest.y };
+    Vector2 points[4] = {
+        { quad.x, quad.y },
+        { quad.x + quad.width, quad.y },
+        { quad.x, quad.y + quad.height },
+        { quad.x + quad.width, quad.y + quad.height }
+    };
+
+    Vector2 min = CguiRotatePoint(points[0], pivot, rotation);
+    Vector2 max = min;
+    for (int i = 1; i < 4; i++)
+    {
+        Vector2 point = CguiRotatePoint(points[i], pivot, rotation);
+        min           = Vector2Min(min, point);
+        max           = Vector2Max(max, point);
+    }
+
+    return (Rectangle) { min.x, min.y, max.x - min.x, max.y - min.y };
+}
+
 void CguiDrawRenderTextureDest(RenderTexture renderTexture, Rectangle dest, Color tint)
 {
     DrawTexturePro(renderTexture.texture, CguiFlipRectangleY(CguiGetRenderTextureSizeRec(renderTexture), 0.0f), dest, Vector2Zero(), 0.0f, tint);
@@ -459,7 +555,9 @@ Rectangle CguiGetMonitorSizeRec(int monitor)
 
 int CguiGetAppWidth(void)
 {
-    if (IsWindowFullscreen())
+    if (cguiAppWidthOverride > 0)
+        return cguiAppWidthOverride;
+    else if (IsWindowFullscreen())
         return GetMonitorWidth(GetCurrentMonitor());
     else
         return GetScreenWidth();
@@ -467,7 +565,9 @@ int CguiGetAppWidth(void)
 
 int CguiGetAppHeight(void)
 {
-    if (IsWindowFullscreen())
+    if (cguiAppHeightOverride > 0)
+        return cguiAppHeightOverride;
+    else if (IsWindowFullscreen())
         return GetMonitorHeight(GetCurrentMonitor());
     else
         return GetScreenHeight();
@@ -483,12 +583,18 @@ Rectangle CguiGetAppSizeRec(void)
     return (Rectangle) { 0.0f, 0.0f, (float) CguiGetAppWidth(), (float) CguiGetAppHeight() };
 }
 
+void CguiSetAppSize(int width, int height)
+{
+    cguiAppWidthOverride  = width;
+    cguiAppHeightOverride = height;
+}
+
 // Misc.
 
 Vector2 CguiRotatePoint(Vector2 point, Vector2 origin, float angle)
 {
     Vector2 po      = Vector2Subtract(point, origin);
-    Vector2 rotated = Vector2Rotate(po, angle);
+    Vector2 rotated = Vector2Rotate(po, angle * DEG2RAD);
     Vector2 ro      = Vector2Add(rotated, origin);
     return ro;
 }
@@ -500,7 +606,7 @@ Rectangle CguiRecZero(void)
 
 bool CguiIsRectangleEqual(Rectangle a, Rectangle b)
 {
-    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+    return CguiIsRectangleEqualP(&a, &b);
 }
 
 bool CguiIsColorEqual(Color a, Color b)
@@ -680,6 +786,60 @@ void CguiBeginScissorModeRec(Rectangle area)
     BeginScissorMode(area.x, area.y, area.width, area.height);
 }
 
+bool CguiPushScissorRec(Rectangle area)
+{
+    // Resize capacity if full
+    if (cguiScissorStackCount == cguiScissorStackCapacity)
+    {
+        int        newCapacity = (cguiScissorStackCapacity == 0) ? 8 : (cguiScissorStackCapacity * 2);
+        Rectangle *newStack    = CG_REALLOC(cguiScissorStack, sizeof(Rectangle) * newCapacity);
+        if (!newStack)
+        {
+            return false;
+        }
+
+        cguiScissorStack         = newStack;
+        cguiScissorStackCapacity = newCapacity;
+    }
+
+    // Nested area is limited to the current area
+    Rectangle current = CguiGetScissorRec();
+    float     left    = fmaxf(area.x, current.x);
+    float     top     = fmaxf(area.y, current.y);
+    float     right   = fminf(area.x + area.width, current.x + current.width);
+    float     bottom  = fminf(area.y + area.height, current.y + current.height);
+    Rectangle clipped = { left, top, fmaxf(right - left, 0.0f), fmaxf(bottom - top, 0.0f) };
+
+    cguiScissorStack[cguiScissorStackCount++] = clipped;
+    CguiEmitScissor(clipped);
+
+    return true;
+}
+
+void CguiPopScissor(void)
+{
+    if (cguiScissorStackCount == 0)
+    {
+        return;
+    }
+
+    cguiScissorStackCount--;
+
+    if (cguiScissorStackCount > 0)
+    {
+        CguiEmitScissor(cguiScissorStack[cguiScissorStackCount - 1]);
+    }
+    else
+    {
+        CguiEmitScissorEnd();
+    }
+}
+
+Rectangle CguiGetScissorRec(void)
+{
+    return cguiScissorStackCount > 0 ? cguiScissorStack[cguiScissorStackCount - 1] : CguiGetAppSizeRec();
+}
+
 Rectangle CguiFlipRectangleX(Rectangle rec, float axis)
 {
     rec.x -= axis;
@@ -702,3 +862,13 @@ Rectangle CguiFlipRectangleXY(Rectangle rec, Vector2 axis)
 {
     return CguiFlipRectangleX(CguiFlipRectangleY(rec, axis.y), axis.x);
 }
+
+Rectangle CguiGetRectangleUnion(Rectangle a, Rectangle b)
+{
+    float left   = fminf(a.x, b.x);
+    float top    = fminf(a.y, b.y);
+    float right  = fmaxf(a.x + a.width, b.x + b.width);
+    float bottom = fmaxf(a.y + a.height, b.y + b.height);
+
+    return (Rectangle) { left, top, right - left, bottom - top };
+}
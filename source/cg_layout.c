@@ -120,6 +120,38 @@ CguiNode *CguiCreateLinearLayout(CguiTransformation transformation, int directio
     return node;
 }
 
+// Check if the linear layout's inputs are same as the last arrangement
+static bool CguiIsLinearLayoutCached(CguiNode *node)
+{
+    CguiLinearLayoutData *layoutData = node->data;
+
+    if (!layoutData->cached ||
+        layoutData->cachedSize.x != node->bounds.width || layoutData->cachedSize.y != node->bounds.height ||
+        layoutData->cachedDirection != layoutData->direction || layoutData->cachedJustify != layoutData->justify ||
+        layoutData->cachedSpacing != layoutData->spacing || layoutData->cachedCount != node->childrenCount)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < node->childrenCount; i++)
+    {
+        CguiNode *child = node->children[i];
+        if (child->type != CGUI_LAYOUT_NODE_TYPE_LINEAR_ITEM || !child->data)
+        {
+            continue;
+        }
+
+        CguiLinearLayoutItemData *itemData = child->data;
+        if (itemData->cachedLayout != node || itemData->cachedIndex != i ||
+            itemData->cachedWeight != itemData->weight || itemData->cachedMinSize != itemData->minSize || itemData->cachedMaxSize != itemData->maxSize)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool CguiTransformLinearLayout(CguiNode *node)
 {
     if (!node || node->type != CGUI_LAYOUT_NODE_TYPE_LINEAR || !node->data)
@@ -129,6 +161,12 @@ bool CguiTransformLinearLayout(CguiNode *node)
 
     CguiLinearLayoutData *layoutData = node->data;
 
+    // Optimization: Nothing to rearrange
+    if (CguiIsLinearLayoutCached(node))
+    {
+        return false;
+    }
+
     Rectangle pBounds      = node->bounds;
     bool      isHorizontal = layoutData->direction == CGUI_LAYOUT_DIRECTION_X;
     float     parentSize   = isHorizontal ? pBounds.width : pBounds.height;
@@ -225,9 +263,23 @@ bool CguiTransformLinearLayout(CguiNode *node)
             t.size.x     = pBounds.width;
         }
 
+        // Only items whose slot moved will rebound
         CguiSetTransformation(child, t);
+
+        itemData->cachedLayout  = node;
+        itemData->cachedIndex   = i;
+        itemData->cachedWeight  = itemData->weight;
+        itemData->cachedMinSize = itemData->minSize;
+        itemData->cachedMaxSize = itemData->maxSize;
     }
 
+    layoutData->cached          = true;
+    layoutData->cachedSize      = (Vector2) { pBounds.width, pBounds.height };
+    layoutData->cachedDirection = layoutData->direction;
+    layoutData->cachedJustify   = layoutData->justify;
+    layoutData->cachedSpacing   = layoutData->spacing;
+    layoutData->cachedCount     = node->childrenCount;
+
     return false; // Layout size itself never changes, return false
 }
 
@@ -379,24 +431,92 @@ static bool CguiGridLayoutRemoveSlot(CguiGridLayoutSlotData **slots, int *count,
 
 bool CguiGridLayoutInsertSlotX(CguiGridLayoutData *layoutData, int index, float weight, float minSize, float maxSize)
 {
+    layoutData->cached = false;
     return CguiGridLayoutInsertSlot(&layoutData->xSlots, &layoutData->xSlotsCount, &layoutData->xSlotsCapacity, index, weight, minSize, maxSize);
 }
 
 bool CguiGridLayoutRemoveSlotX(CguiGridLayoutData *layoutData, int index)
 {
+    layoutData->cached = false;
     return CguiGridLayoutRemoveSlot(&layoutData->xSlots, &layoutData->xSlotsCount, &layoutData->xSlotsCapacity, index);
 }
 
 bool CguiGridLayoutInsertSlotY(CguiGridLayoutData *layoutData, int index, float weight, float minSize, float maxSize)
 {
+    layoutData->cached = false;
     return CguiGridLayoutInsertSlot(&layoutData->ySlots, &layoutData->ySlotsCount, &layoutData->ySlotsCapacity, index, weight, minSize, maxSize);
 }
 
 bool CguiGridLayoutRemoveSlotY(CguiGridLayoutData *layoutData, int index)
 {
+    layoutData->cached = false;
     return CguiGridLayoutRemoveSlot(&layoutData->ySlots, &layoutData->ySlotsCount, &layoutData->ySlotsCapacity, index);
 }
 
+static bool CguiIsGridLayoutSlotsCached(CguiGridLayoutSlotData *slots, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (slots[i].cachedWeight != slots[i].weight || slots[i].cachedMinSize != slots[i].minSize || slots[i].cachedMaxSize != slots[i].maxSize)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void CguiCacheGridLayoutSlots(CguiGridLayoutSlotData *slots, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        slots[i].cachedWeight  = slots[i].weight;
+        slots[i].cachedMinSize = slots[i].minSize;
+        slots[i].cachedMaxSize = slots[i].maxSize;
+    }
+}
+
+// Check if the grid layout's inputs are same as the last arrangement
+static bool CguiIsGridLayoutCached(CguiNode *node)
+{
+    CguiGridLayoutData *layoutData = node->data;
+
+    if (!layoutData->cached ||
+        layoutData->cachedSize.x != node->bounds.width || layoutData->cachedSize.y != node->bounds.height ||
+        layoutData->cachedXSlotsCount != layoutData->xSlotsCount || layoutData->cachedYSlotsCount != layoutData->ySlotsCount ||
+        layoutData->cachedXJustify != layoutData->xJustify || layoutData->cachedYJustify != layoutData->yJustify ||
+        layoutData->cachedSpacing.x != layoutData->spacing.x || layoutData->cachedSpacing.y != layoutData->spacing.y ||
+        layoutData->cachedCount != node->childrenCount)
+    {
+        return false;
+    }
+
+    if (!CguiIsGridLayoutSlotsCached(layoutData->xSlots, layoutData->xSlotsCount) ||
+        !CguiIsGridLayoutSlotsCached(layoutData->ySlots, layoutData->ySlotsCount))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < node->childrenCount; i++)
+    {
+        CguiNode *child = node->children[i];
+        if (child->type != CGUI_LAYOUT_NODE_TYPE_GRID_ITEM || !child->data)
+        {
+            continue;
+        }
+
+        CguiGridLayoutItemData *itemData = child->data;
+        if (itemData->cachedLayout != node || itemData->cachedIndex != i ||
+            itemData->cachedXSlot != itemData->xSlot || itemData->cachedYSlot != itemData->ySlot ||
+            itemData->cachedXSpan != itemData->xSpan || itemData->cachedYSpan != itemData->ySpan)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool CguiTransformGridLayout(CguiNode *node)
 {
     if (!node || node->type != CGUI_LAYOUT_NODE_TYPE_GRID || !node->data)
@@ -412,6 +532,12 @@ bool CguiTransformGridLayout(CguiNode *node)
         return false;
     }
 
+    // Optimization: Nothing to rearrange
+    if (CguiIsGridLayoutCached(node))
+    {
+        return false;
+    }
+
     Rectangle pBounds    = node->bounds;
     Vector2   parentSize = { pBounds.width, pBounds.height };
 
@@ -525,6 +651,13 @@ bool CguiTransformGridLayout(CguiNode *node)
         CguiTransformation      t        = { 0 };
         t.isRelativePosition             = (Vector2) { 1.0f, 1.0f };
 
+        itemData->cachedLayout = node;
+        itemData->cachedIndex  = i;
+        itemData->cachedXSlot  = itemData->xSlot;
+        itemData->cachedYSlot  = itemData->ySlot;
+        itemData->cachedXSpan  = itemData->xSpan;
+        itemData->cachedYSpan  = itemData->ySpan;
+
         // Invalid slot indices
         if (itemData->xSlot < 0 || itemData->xSlot >= layoutData->xSlotsCount ||
             itemData->ySlot < 0 || itemData->ySlot >= layoutData->ySlotsCount ||
@@ -540,9 +673,22 @@ bool CguiTransformGridLayout(CguiNode *node)
         t.size.x     = layoutData->xSlots[itemData->xSlot + itemData->xSpan - 1].position + layoutData->xSlots[itemData->xSlot + itemData->xSpan - 1].size - t.position.x;
         t.size.y     = layoutData->ySlots[itemData->ySlot + itemData->ySpan - 1].position + layoutData->ySlots[itemData->ySlot + itemData->ySpan - 1].size - t.position.y;
 
+        // Only items whose slot moved will rebound
         CguiSetTransformation(child, t);
     }
 
+    CguiCacheGridLayoutSlots(layoutData->xSlots, layoutData->xSlotsCount);
+    CguiCacheGridLayoutSlots(layoutData->ySlots, layoutData->ySlotsCount);
+
+    layoutData->cached            = true;
+    layoutData->cachedSize        = parentSize;
+    layoutData->cachedXSlotsCount = layoutData->xSlotsCount;
+    layoutData->cachedYSlotsCount = layoutData->ySlotsCount;
+    layoutData->cachedXJustify    = layoutData->xJustify;
+    layoutData->cachedYJustify    = layoutData->yJustify;
+    layoutData->cachedSpacing     = layoutData->spacing;
+    layoutData->cachedCount       = node->childrenCount;
+
     return false; // Layout size itself never changes, return false
 }
 
@@ -559,3 +705,657 @@ CguiNode *CguiCreateGridLayoutItem(int xSlot, int ySlot, int xSpan, int ySpan)
 
     return node;
 }
+
+CguiNode *CguiCreateVirtualList(CguiTransformation transformation, int direction, float spacing, int itemsCount, float itemExtent, CguiVirtualListCreateFunction createItemFunction, CguiVirtualListBindFunction bindItemFunction)
+{
+    CguiNode *node = CguiCreateNodePro(transformation, TextFormat("CguiVirtualList #%d", ++cguiNameCounter), CGUI_LAYOUT_NODE_TYPE_VIRTUAL_LIST, NULL, sizeof(CguiVirtualListData));
+    if (!node)
+    {
+        return NULL;
+    }
+
+    CguiVirtualListData data = { .direction = direction, .spacing = spacing, .itemsCount = itemsCount, .itemExtent = itemExtent, .createItemFunction = createItemFunction, .bindItemFunction = bindItemFunction };
+    memcpy(node->data, &data, sizeof(CguiVirtualListData));
+
+    node->transform      = CguiTransformVirtualList;
+    node->deleteNodeData = CguiDeleteVirtualListData;
+
+    return node;
+}
+
+void CguiDeleteVirtualListData(CguiNode *node)
+{
+    if (!node || node->type != CGUI_LAYOUT_NODE_TYPE_VIRTUAL_LIST || !node->data)
+    {
+        return;
+    }
+
+    CguiVirtualListData *listData = node->data;
+
+    // Realized item nodes are children, only the pooled ones are owned here
+    for (int i = 0; i < listData->poolCount; i++)
+    {
+        CguiDeleteNode(listData->pool[i]);
+    }
+
+    CG_FREE_NULL(listData->pool);
+    listData->poolCount    = 0;
+    listData->poolCapacity = 0;
+
+    CG_FREE_NULL(listData->offsets);
+    listData->offsetsCount    = 0;
+    listData->offsetsCapacity = 0;
+}
+
+// Measure the items before the item with the extent function, the offsets of the measured items are kept
+static bool CguiMeasureVirtualListItems(CguiNode *node, int item)
+{
+    CguiVirtualListData *listData = node->data;
+
+    if (item > listData->itemsCount)
+    {
+        item = listData->itemsCount;
+    }
+
+    if (item < listData->offsetsCount)
+    {
+        return true;
+    }
+
+    // Resize capacity if full
+    if (item + 1 > listData->offsetsCapacity)
+    {
+        int newCapacity = (listData->offsetsCapacity == 0) ? 64 : listData->offsetsCapacity;
+        while (newCapacity < item + 1)
+        {
+            newCapacity *= 2;
+        }
+
+        double *newOffsets = CG_REALLOC(listData->offsets, sizeof(double) * newCapacity);
+        if (!newOffsets)
+        {
+            return false;
+        }
+
+        listData->offsets         = newOffsets;
+        listData->offsetsCapacity = newCapacity;
+    }
+
+    for (int i = listData->offsetsCount - 1; i < item; i++)
+    {
+        listData->offsets[i + 1] = listData->offsets[i] + listData->itemExtentFunction(node, i) + listData->spacing;
+    }
+
+    listData->offsetsCount = item + 1;
+
+    return true;
+}
+
+// Forget the measured items if items or spacing changed since the last arrangement (measured again on demand)
+static bool CguiUpdateVirtualListOffsets(CguiNode *node)
+{
+    CguiVirtualListData *listData = node->data;
+
+    if (!listData->itemExtentFunction)
+    {
+        CG_FREE_NULL(listData->offsets);
+        listData->offsetsCount    = 0;
+        listData->offsetsCapacity = 0;
+        return true;
+    }
+
+    if (listData->offsetsCount > 0 && listData->cached && listData->cachedCount == listData->itemsCount && listData->cachedSpacing == listData->spacing)
+    {
+        return true;
+    }
+
+    // Optimization: Only the count changed, items still in the list keep their measured offsets
+    if (listData->offsetsCount > 0 && listData->cached && listData->cachedSpacing == listData->spacing)
+    {
+        listData->offsetsCount = listData->offsetsCount < listData->itemsCount + 1 ? listData->offsetsCount : listData->itemsCount + 1;
+        return true;
+    }
+
+    if (!listData->offsets)
+    {
+        listData->offsets = CG_MALLOC_NULL(sizeof(double) * 64);
+        if (!listData->offsets)
+        {
+            return false;
+        }
+
+        listData->offsetsCapacity = 64;
+    }
+
+    listData->offsets[0]   = 0.0;
+    listData->offsetsCount = 1;
+
+    return true;
+}
+
+// Offset of an item, items not measured yet are estimated to be `itemExtent` long
+static double CguiGetVirtualListItemOffset(CguiVirtualListData *listData, int item)
+{
+    if (!listData->offsets)
+    {
+        return (double) item * (listData->itemExtent + listData->spacing);
+    }
+
+    if (item < listData->offsetsCount)
+    {
+        return listData->offsets[item];
+    }
+
+    int measured = listData->offsetsCount - 1;
+    return listData->offsets[measured] + (double) (item - measured) * (listData->itemExtent + listData->spacing);
+}
+
+static float CguiGetVirtualListItemExtent(CguiVirtualListData *listData, int item)
+{
+    if (!listData->offsets || item + 1 >= listData->offsetsCount)
+    {
+        return listData->itemExtent;
+    }
+
+    return (float) (listData->offsets[item + 1] - listData->offsets[item] - listData->spacing);
+}
+
+// Total extent of the items from the current offsets
+static float CguiGetVirtualListItemsExtent(CguiVirtualListData *listData)
+{
+    if (listData->itemsCount == 0)
+    {
+        return 0.0f;
+    }
+
+    // No spacing after the last item
+    return (float) (CguiGetVirtualListItemOffset(listData, listData->itemsCount) - listData->spacing);
+}
+
+// Move an item node to the pool
+static void CguiRecycleVirtualListItem(CguiNode *node, int childIndex)
+{
+    CguiVirtualListData *listData = node->data;
+    CguiNode            *itemNode = node->children[childIndex];
+
+    CguiRemoveChildAt(node, childIndex);
+
+    // Resize capacity if full
+    if (listData->poolCount == listData->poolCapacity)
+    {
+        int        newCapacity = (listData->poolCapacity == 0) ? 8 : (listData->poolCapacity * 2);
+        CguiNode **newPool     = CG_REALLOC(listData->pool, sizeof(CguiNode *) * newCapacity);
+        if (!newPool)
+        {
+            CguiDeleteNode(itemNode);
+            return;
+        }
+
+        listData->pool         = newPool;
+        listData->poolCapacity = newCapacity;
+    }
+
+    listData->pool[listData->poolCount++] = itemNode;
+}
+
+// Take an item node from the pool (or create one) and bind the item to it
+static CguiNode *CguiRealizeVirtualListItem(CguiNode *node, int item)
+{
+    CguiVirtualListData *listData = node->data;
+    CguiNode            *itemNode = NULL;
+
+    if (listData->poolCount > 0)
+    {
+        itemNode = listData->pool[--listData->poolCount];
+    }
+    else if (listData->createItemFunction)
+    {
+        itemNode = listData->createItemFunction(node);
+    }
+
+    if (!itemNode)
+    {
+        return NULL;
+    }
+
+    if (listData->bindItemFunction)
+    {
+        listData->bindItemFunction(node, itemNode, item);
+    }
+
+    return itemNode;
+}
+
+bool CguiTransformVirtualList(CguiNode *node)
+{
+    if (!node || node->type != CGUI_LAYOUT_NODE_TYPE_VIRTUAL_LIST || !node->data)
+    {
+        return false;
+    }
+
+    CguiVirtualListData *listData = node->data;
+
+    Rectangle pBounds      = node->bounds;
+    bool      isHorizontal = listData->direction == CGUI_LAYOUT_DIRECTION_X;
+    float     parentSize   = isHorizontal ? pBounds.width : pBounds.height;
+
+    if (!CguiUpdateVirtualListOffsets(node))
+    {
+        CG_LOG_ERROR("Failed to compute item offsets of %s", node->name);
+        return false;
+    }
+
+    // Optimization: Offsets were updated above, do not update them again for the extent
+    listData->scroll = Clamp(listData->scroll, 0.0f, fmaxf(CguiGetVirtualListItemsExtent(listData) - parentSize, 0.0f));
+
+    // Optimization: Nothing to rearrange
+    if (listData->cached && !listData->rebind &&
+        listData->cachedSize.x == pBounds.width && listData->cachedSize.y == pBounds.height &&
+        listData->cachedDirection == listData->direction && listData->cachedSpacing == listData->spacing &&
+        listData->cachedScroll == listData->scroll && listData->cachedCount == listData->itemsCount)
+    {
+        return false;
+    }
+
+    // Binary search the visible items range [first, end), measuring until the range is within the measured items
+    int first = 0;
+    int end   = listData->itemsCount;
+
+    while (true)
+    {
+        // Note: Measured items may be shorter than estimated, the scroll is clamped again
+        listData->scroll = Clamp(listData->scroll, 0.0f, fmaxf(CguiGetVirtualListItemsExtent(listData) - parentSize, 0.0f));
+
+        double begin = listData->scroll;
+        double limit = begin + parentSize;
+
+        first = 0;
+        end   = listData->itemsCount;
+        while (first < end)
+        {
+            int mid = first + (end - first) / 2;
+            if (CguiGetVirtualListItemOffset(listData, mid) + CguiGetVirtualListItemExtent(listData, mid) > begin) end = mid;
+            else first = mid + 1;
+        }
+
+        int low = first;
+        end     = listData->itemsCount;
+        while (low < end)
+        {
+            int mid = low + (end - low) / 2;
+            if (CguiGetVirtualListItemOffset(listData, mid) >= limit) end = mid;
+            else low = mid + 1;
+        }
+
+        if (!listData->offsets || end < listData->offsetsCount)
+        {
+            break;
+        }
+
+        if (!CguiMeasureVirtualListItems(node, end))
+        {
+            CG_LOG_ERROR("Failed to measure items of %s", node->name);
+            return false;
+        }
+    }
+
+    if (parentSize <= 0.0f)
+    {
+        end = first;
+    }
+
+    // Recycle the items scrolled out (or all the items, if re-binding)
+    while (node->childrenCount > 0 && (listData->rebind || listData->firstItem < first))
+    {
+        CguiRecycleVirtualListItem(node, 0);
+        listData->firstItem++;
+    }
+
+    while (node->childrenCount > 0 && listData->firstItem + node->childrenCount > end)
+    {
+        CguiRecycleVirtualListItem(node, node->childrenCount - 1);
+    }
+
+    if (node->childrenCount == 0)
+    {
+        listData->firstItem = first;
+    }
+
+    // Realize the items scrolled in
+    while (listData->firstItem > first)
+    {
+        CguiNode *itemNode = CguiRealizeVirtualListItem(node, listData->firstItem - 1);
+        if (!itemNode || !CguiInsertChildAt(node, itemNode, 0))
+        {
+            CguiDeleteNode(itemNode);
+            break;
+        }
+
+        listData->firstItem--;
+    }
+
+    while (listData->firstItem + node->childrenCount < end)
+    {
+        CguiNode *itemNode = CguiRealizeVirtualListItem(node, listData->firstItem + node->childrenCount);
+        if (!itemNode || !CguiInsertChild(node, itemNode))
+        {
+            CguiDeleteNode(itemNode);
+            break;
+        }
+    }
+
+    for (int i = 0; i < node->childrenCount; i++)
+    {
+        int item = listData->firstItem + i;
+
+        CguiTransformation t = { 0 };
+        t.isRelativePosition = (Vector2) { 1.0f, 1.0f };
+
+        if (isHorizontal)
+        {
+            t.position.x = (float) (CguiGetVirtualListItemOffset(listData, item) - listData->scroll);
+            t.size.x     = CguiGetVirtualListItemExtent(listData, item);
+            t.size.y     = pBounds.height;
+        }
+        else
+        {
+            t.position.y = (float) (CguiGetVirtualListItemOffset(listData, item) - listData->scroll);
+            t.size.y     = CguiGetVirtualListItemExtent(listData, item);
+            t.size.x     = pBounds.width;
+        }
+
+        // Only items that moved will rebound
+        CguiSetTransformation(node->children[i], t);
+    }
+
+    listData->rebind          = false;
+    listData->cached          = true;
+    listData->cachedSize      = (Vector2) { pBounds.width, pBounds.height };
+    listData->cachedDirection = listData->direction;
+    listData->cachedSpacing   = listData->spacing;
+    listData->cachedScroll    = listData->scroll;
+    listData->cachedCount     = listData->itemsCount;
+
+    return false; // List size itself never changes, return false
+}
+
+void CguiRefreshVirtualList(CguiNode *node)
+{
+    if (!node || node->type != CGUI_LAYOUT_NODE_TYPE_VIRTUAL_LIST || !node->data)
+    {
+        return;
+    }
+
+    CguiVirtualListData *listData = node->data;
+
+    listData->cached = false;
+    listData->rebind = true;
+}
+
+int CguiGetVirtualListItem(CguiNode *node, CguiNode *itemNode)
+{
+    if (!node || node->type != CGUI_LAYOUT_NODE_TYPE_VIRTUAL_LIST || !node->data)
+    {
+        return -1;
+    }
+
+    CguiVirtualListData *listData = node->data;
+
+    // Find the child of the list
+    while (itemNode && itemNode->parent != node)
+    {
+        itemNode = itemNode->parent;
+    }
+
+    if (!itemNode)
+    {
+        return -1;
+    }
+
+    return listData->firstItem + itemNode->childIndex;
+}
+
+float CguiGetVirtualListExtent(CguiNode *node)
+{
+    if (!node || node->type != CGUI_LAYOUT_NODE_TYPE_VIRTUAL_LIST || !node->data)
+    {
+        return 0.0f;
+    }
+
+    CguiVirtualListData *listData = node->data;
+    if (listData->itemsCount == 0 || !CguiUpdateVirtualListOffsets(node))
+    {
+        return 0.0f;
+    }
+
+    // Note: Items not measured yet are estimated to be `itemExtent` long
+    return CguiGetVirtualListItemsExtent(listData);
+}
+
+CguiNode *CguiCreateScrollView(CguiTransformation transformation, Vector2 contentSize)
+{
+    CguiNode *node = CguiCreateNodePro(transformation, TextFormat("CguiScrollView #%d", ++cguiNameCounter), CGUI_LAYOUT_NODE_TYPE_SCROLL_VIEW, NULL, sizeof(CguiScrollViewData));
+    if (!node)
+    {
+        return NULL;
+    }
+
+    CguiNode *contentNode = CguiCreateNodePro(CguiTZeroSize(), TextFormat("CguiScrollViewContent #%d", ++cguiNameCounter), CGUI_LAYOUT_NODE_TYPE_SCROLL_CONTENT, NULL, 0);
+    if (!contentNode || !CguiInsertChild(node, contentNode))
+    {
+        CguiDeleteNode(contentNode);
+        CguiDeleteNode(node);
+        return NULL;
+    }
+
+    CguiScrollViewData data = { .contentSize = contentSize, .wheelSpeed = 1200.0f, .friction = 6.0f };
+    memcpy(node->data, &data, sizeof(CguiScrollViewData));
+
+    node->clipChildren         = true;
+    node->canHandleMouseEvents = true;
+    node->transform            = CguiTransformScrollView;
+    node->updatePre            = CguiUpdatePreScrollView;
+    node->drawPre              = CguiDrawPreScrollView;
+    node->drawPost             = CguiDrawPostScrollView;
+    node->handleEvent          = CguiHandleEventScrollView;
+
+    return node;
+}
+
+// Size of the content, the view size on the axes it is not set
+static Vector2 CguiGetScrollViewContentSize(CguiNode *node)
+{
+    CguiScrollViewData *viewData = node->data;
+
+    return (Vector2) {
+        viewData->contentSize.x > 0.0f ? viewData->contentSize.x : node->bounds.width,
+        viewData->contentSize.y > 0.0f ? viewData->contentSize.y : node->bounds.height
+    };
+}
+
+// Whether the view can still scroll further in the direction of the wheel move
+static bool CguiCanScrollViewByWheel(CguiNode *node, Vector2 wheel)
+{
+    CguiScrollViewData *viewData  = node->data;
+    Vector2             size      = CguiGetScrollViewContentSize(node);
+    Vector2             maxScroll = { fmaxf(size.x - node->bounds.width, 0.0f), fmaxf(size.y - node->bounds.height, 0.0f) };
+
+    // Wheel moving up (positive) scrolls towards the beginning
+    return (wheel.x > 0.0f && viewData->scroll.x > 0.0f) || (wheel.x < 0.0f && viewData->scroll.x < maxScroll.x) ||
+           (wheel.y > 0.0f && viewData->scroll.y > 0.0f) || (wheel.y < 0.0f && viewData->scroll.y < maxScroll.y);
+}
+
+// Whether a scroll view inside the view, under the mouse, takes the wheel move instead
+static bool CguiIsWheelTakenInside(CguiNode *node, Vector2 mousePosition, Vector2 wheel)
+{
+    for (CguiNode *inner = CguiFindFirstNodeOfType(node, CGUI_LAYOUT_NODE_TYPE_SCROLL_VIEW); inner; inner = CguiFindNextNodeOfType(node, inner))
+    {
+        if (inner != node && inner->enabled && inner->data && CheckCollisionPointRec(mousePosition, inner->bounds) && CguiCanScrollViewByWheel(inner, wheel))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool CguiTransformScrollView(CguiNode *node)
+{
+    CguiNode *contentNode = CguiGetScrollViewContent(node);
+    if (!contentNode)
+    {
+        return false;
+    }
+
+    CguiScrollViewData *viewData = node->data;
+
+    Vector2 size      = CguiGetScrollViewContentSize(node);
+    Vector2 maxScroll = { fmaxf(size.x - node->bounds.width, 0.0f), fmaxf(size.y - node->bounds.height, 0.0f) };
+
+    // Stop at the edges (moving away from them is kept, the clock may not have advanced yet)
+    if ((viewData->scroll.x <= 0.0f && viewData->velocity.x < 0.0f) || (viewData->scroll.x >= maxScroll.x && viewData->velocity.x > 0.0f)) viewData->velocity.x = 0.0f;
+    if ((viewData->scroll.y <= 0.0f && viewData->velocity.y < 0.0f) || (viewData->scroll.y >= maxScroll.y && viewData->velocity.y > 0.0f)) viewData->velocity.y = 0.0f;
+
+    viewData->scroll.x = Clamp(viewData->scroll.x, 0.0f, maxScroll.x);
+    viewData->scroll.y = Clamp(viewData->scroll.y, 0.0f, maxScroll.y);
+
+    CguiTransformation t = { 0 };
+    t.isRelativePosition = (Vector2) { 1.0f, 1.0f };
+    t.position           = Vector2Negate(viewData->scroll);
+    t.size               = size;
+
+    // Only rebounds when scrolled or resized
+    CguiSetTransformation(contentNode, t);
+
+    return false; // View size itself never changes, return false
+}
+
+void CguiUpdatePreScrollView(CguiNode *node)
+{
+    if (!node || node->type != CGUI_LAYOUT_NODE_TYPE_SCROLL_VIEW || !node->data)
+    {
+        return;
+    }
+
+    CguiScrollViewData *viewData      = node->data;
+    Vector2             mousePosition = GetMousePosition();
+    float               deltaTime     = CguiGetTransitionDeltaTime(); // Smoothing follows the transition clock
+
+    // Release may have been consumed elsewhere
+    if (viewData->dragging && !IsMouseButtonDown(MOUSE_BUTTON_LEFT))
+    {
+        viewData->dragging = false;
+    }
+
+    if (viewData->dragging)
+    {
+        Vector2 delta          = Vector2Subtract(mousePosition, viewData->dragPosition);
+        viewData->scroll       = Vector2Subtract(viewData->scroll, delta);
+        viewData->dragPosition = mousePosition;
+
+        // Clock may not advance every update (fixed step or paused), keep the last velocity
+        if (deltaTime > 0.0f)
+        {
+            viewData->velocity = Vector2Scale(delta, -1.0f / deltaTime);
+        }
+
+        return;
+    }
+
+    // Only the innermost view that can still scroll takes the wheel move
+    Vector2 wheel = GetMouseWheelMoveV();
+    if ((wheel.x != 0.0f || wheel.y != 0.0f) && CheckCollisionPointRec(mousePosition, node->bounds) && !CguiIsWheelTakenInside(node, mousePosition, wheel))
+    {
+        viewData->velocity = Vector2Subtract(viewData->velocity, Vector2Scale(wheel, viewData->wheelSpeed));
+    }
+
+    // Optimization: Resting
+    if (viewData->velocity.x == 0.0f && viewData->velocity.y == 0.0f)
+    {
+        return;
+    }
+
+    viewData->scroll   = Vector2Add(viewData->scroll, Vector2Scale(viewData->velocity, deltaTime));
+    viewData->velocity = Vector2Scale(viewData->velocity, expf(-viewData->friction * deltaTime));
+
+    // Snap to rest instead of decaying forever
+    if (Vector2LengthSqr(viewData->velocity) < 1.0f)
+    {
+        viewData->velocity = Vector2Zero();
+    }
+}
+
+void CguiDrawPreScrollView(CguiNode *node)
+{
+    if (!node)
+    {
+        return;
+    }
+
+    CguiPushScissorRec(node->bounds);
+}
+
+void CguiDrawPostScrollView(CguiNode *node)
+{
+    if (!node)
+    {
+        return;
+    }
+
+    CguiPopScissor();
+}
+
+bool CguiHandleEventScrollView(CguiNode *node, CguiEvent *event)
+{
+    if (!node || !event || node->type != CGUI_LAYOUT_NODE_TYPE_SCROLL_VIEW || !node->data)
+    {
+        return false;
+    }
+
+    CguiScrollViewData *viewData = node->data;
+
+    switch (event->eventType)
+    {
+        case CGUI_EVENT_TYPE_MOUSE_BUTTON_PRESS: {
+            CguiMouseButtonPressEvent *buttonPressEvent = (CguiMouseButtonPressEvent *) event;
+            if (buttonPressEvent->button != MOUSE_BUTTON_LEFT)
+            {
+                return false;
+            }
+
+            viewData->dragging     = true;
+            viewData->dragPosition = GetMousePosition();
+            viewData->velocity     = Vector2Zero();
+            return true;
+        }
+
+        case CGUI_EVENT_TYPE_MOUSE_BUTTON_RELEASE: {
+            CguiMouseButtonReleaseEvent *buttonReleaseEvent = (CguiMouseButtonReleaseEvent *) event;
+            if (buttonReleaseEvent->button == MOUSE_BUTTON_LEFT)
+            {
+                viewData->dragging = false;
+            }
+
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+CguiNode *CguiGetScrollViewContent(CguiNode *node)
+{
+    if (!node || node->type != CGUI_LAYOUT_NODE_TYPE_SCROLL_VIEW || !node->data || node->childrenCount == 0)
+    {
+        return NULL;
+    }
+
+    CguiNode *contentNode = node->children[0];
+    if (contentNode->type != CGUI_LAYOUT_NODE_TYPE_SCROLL_CONTENT)
+    {
+        return NULL;
+    }
+
+    return contentNode;
+}
@@ -9,12 +9,854 @@
 ///
 /// This project is licensed under the terms of MIT license.
 
+#include <math.h>
 #include <string.h>
 
 #include "crystalgui/crystalgui.h"
 #include "raylib.h"
 
-extern int cguiNameCounter;
+// SIMD instruction sets for batched bounds computation (define CG_NO_SIMD to use scalar only)
+#ifndef CG_NO_SIMD
+#if defined(__AVX__)
+#include <immintrin.h>
+#define CGUI_SIMD_AVX
+#endif
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define CGUI_SIMD_SSE
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CGUI_SIMD_NEON
+#endif
+#endif // CG_NO_SIMD
+
+// Minimum number of children to compute their bounds in batch
+#ifndef CGUI_BOUNDS_BATCH_THRESHOLD
+#define CGUI_BOUNDS_BATCH_THRESHOLD 16
+#endif
+
+extern int          cguiNameCounter;
+extern unsigned int cguiTreeVersion;
+extern float       *cguiBoundsBatch;
+extern int          cguiBoundsBatchCapacity;
+extern CguiNode   **cguiDeleteQueue;
+extern int          cguiDeleteQueueCount;
+extern int          cguiDeleteQueueCapacity;
+extern CguiNode   **cguiOcclusionNodes;
+extern int          cguiOcclusionNodesCount;
+extern int          cguiOcclusionNodesCapacity;
+
+// Traversal stack
+// All tree traversals share this stack instead of recursing, to avoid stack
+// overflow with deep trees. Traversals started from within handlers (nested
+// traversals) use the stack above the current top and unwind back to it.
+
+struct CguiTraversalEntry;
+typedef struct CguiTraversalEntry CguiTraversalEntry;
+
+struct CguiTraversalEntry {
+    CguiNode *node;    // Traversed node
+    int       index;   // Next child (or instance) index to traverse
+    bool      flag;    // Propagated flag (rebound, resync)
+    bool      batched; // Children bounds already computed in batch
+    bool      culled;  // Node itself culled (culling traversals)
+    Rectangle clip;    // Area children are clipped to (culling traversals)
+};
+
+extern CguiTraversalEntry *cguiTraversalStack;
+extern int                 cguiTraversalStackCount;
+extern int                 cguiTraversalStackCapacity;
+
+static bool CguiPushTraversal(CguiNode *node, int index, bool flag)
+{
+    // Resize capacity if full (never shrinks, the stack is reused)
+    if (cguiTraversalStackCount == cguiTraversalStackCapacity)
+    {
+        int                 newCapacity = (cguiTraversalStackCapacity == 0) ? 64 : (cguiTraversalStackCapacity * 2);
+        CguiTraversalEntry *newStack    = CG_REALLOC(cguiTraversalStack, sizeof(CguiTraversalEntry) * newCapacity);
+        if (!newStack)
+        {
+            CG_LOG_ERROR("Failed to grow traversal stack to %d entries", newCapacity);
+            return false;
+        }
+
+        cguiTraversalStack         = newStack;
+        cguiTraversalStackCapacity = newCapacity;
+    }
+
+    cguiTraversalStack[cguiTraversalStackCount] = (CguiTraversalEntry) { .node = node, .index = index, .flag = flag };
+    cguiTraversalStackCount++;
+
+    return true;
+}
+
+// Traverse node and children, calling pre before and post (optional) after children
+// Culling skips the handlers of nodes outside the window, scissor area and the bounds of clipping parents
+// Note: Entries are re-read after every handler since nested traversals may reallocate the stack
+static void CguiTraverseNode(CguiNode *node, CguiNodeFunction pre, CguiNodeFunction post, bool cull)
+{
+    // Disabled nodes are skipped, including their children
+    if (!node->enabled)
+    {
+        return;
+    }
+
+    int       base         = cguiTraversalStackCount;
+    Rectangle clip         = cull ? CguiGetScissorRec() : (Rectangle) { 0 };
+    bool      culled       = false;
+    bool      cullChildren = false;
+
+    if (cull) culled = CguiIsNodeCulled(node, clip, &cullChildren);
+    if (cullChildren)
+    {
+        return;
+    }
+
+    if (!culled) pre(node);
+    if (!CguiPushTraversal(node, 0, false))
+    {
+        return;
+    }
+
+    cguiTraversalStack[cguiTraversalStackCount - 1].culled = culled;
+    if (cull) cguiTraversalStack[cguiTraversalStackCount - 1].clip = CguiClipNodeChildren(node, clip);
+
+    while (cguiTraversalStackCount > base)
+    {
+        CguiTraversalEntry *top = &cguiTraversalStack[cguiTraversalStackCount - 1];
+
+        if (top->index >= top->node->childrenCount)
+        {
+            CguiNode *done       = top->node;
+            bool      doneCulled = top->culled;
+            cguiTraversalStackCount--;
+            if (post && !doneCulled) post(done);
+            continue;
+        }
+
+        CguiNode *child = top->node->children[top->index++];
+        if (!child || !child->enabled)
+        {
+            continue;
+        }
+
+        clip   = top->clip;
+        culled = false;
+        if (cull) culled = CguiIsNodeCulled(child, clip, &cullChildren);
+
+        // Optimization: Entire subtree culled
+        if (culled && cullChildren)
+        {
+            continue;
+        }
+
+        if (!culled) pre(child);
+        if (!CguiPushTraversal(child, 0, false))
+        {
+            cguiTraversalStackCount = base;
+            return;
+        }
+
+        cguiTraversalStack[cguiTraversalStackCount - 1].culled = culled;
+        if (cull) cguiTraversalStack[cguiTraversalStackCount - 1].clip = CguiClipNodeChildren(child, clip);
+    }
+}
+
+// Handle table
+// Slots of deleted nodes are chained into a free list and reused with the
+// next generation, so stale handles of the old node no longer resolve.
+
+struct CguiHandleSlot;
+typedef struct CguiHandleSlot CguiHandleSlot;
+
+struct CguiHandleSlot {
+    CguiNode    *node;       // Node in this slot (NULL if free)
+    unsigned int generation; // Current generation of this slot (never 0)
+    int          nextFree;   // Next free slot (-1 for none), if free
+};
+
+extern CguiHandleSlot *cguiHandleSlots;
+extern int             cguiHandleSlotsCount;
+extern int             cguiHandleSlotsCapacity;
+extern int             cguiHandleFreeSlot;
+
+// Whether the handle slot of the node belongs to the node
+static bool CguiHasNodeHandle(CguiNode *node)
+{
+    int slot = node->handleSlot - 1;
+    return slot >= 0 && slot < cguiHandleSlotsCount && cguiHandleSlots[slot].node == node;
+}
+
+static void CguiReleaseNodeHandle(CguiNode *node)
+{
+    if (!CguiHasNodeHandle(node))
+    {
+        return;
+    }
+
+    CguiHandleSlot *slot = &cguiHandleSlots[node->handleSlot - 1];
+
+    slot->node = NULL;
+    slot->generation++;
+    if (slot->generation == 0) slot->generation = 1; // Generation 0 is never valid
+    slot->nextFree = cguiHandleFreeSlot;
+
+    cguiHandleFreeSlot = node->handleSlot - 1;
+    node->handleSlot   = 0;
+}
+
+CguiNodeHandle CguiGetNodeHandle(CguiNode *node)
+{
+    if (!node)
+    {
+        return (CguiNodeHandle) { 0 };
+    }
+
+    if (CguiHasNodeHandle(node))
+    {
+        return (CguiNodeHandle) { .index = node->handleSlot - 1, .generation = cguiHandleSlots[node->handleSlot - 1].generation };
+    }
+
+    int slot = cguiHandleFreeSlot;
+    if (slot != -1)
+    {
+        cguiHandleFreeSlot = cguiHandleSlots[slot].nextFree;
+    }
+    else
+    {
+        // Resize capacity if full
+        if (cguiHandleSlotsCount == cguiHandleSlotsCapacity)
+        {
+            int             newCapacity = (cguiHandleSlotsCapacity == 0) ? 64 : (cguiHandleSlotsCapacity * 2);
+            CguiHandleSlot *newSlots    = CG_REALLOC(cguiHandleSlots, sizeof(CguiHandleSlot) * newCapacity);
+            if (!newSlots)
+            {
+                return (CguiNodeHandle) { 0 };
+            }
+
+            cguiHandleSlots         = newSlots;
+            cguiHandleSlotsCapacity = newCapacity;
+        }
+
+        slot                             = cguiHandleSlotsCount++;
+        cguiHandleSlots[slot].generation = 1;
+    }
+
+    cguiHandleSlots[slot].node     = node;
+    cguiHandleSlots[slot].nextFree = -1;
+    node->handleSlot               = slot + 1;
+
+    return (CguiNodeHandle) { .index = slot, .generation = cguiHandleSlots[slot].generation };
+}
+
+CguiNode *CguiResolveHandle(CguiNodeHandle handle)
+{
+    if (handle.generation == 0 || handle.index >= (unsigned int) cguiHandleSlotsCount)
+    {
+        return NULL;
+    }
+
+    CguiHandleSlot *slot = &cguiHandleSlots[handle.index];
+    return slot->generation == handle.generation ? slot->node : NULL;
+}
+
+Rectangle CguiGetNodeVisualBounds(CguiNode *node)
+{
+    if (!node)
+    {
+        return (Rectangle) { 0 };
+    }
+
+    return node->visualBounds ? node->visualBounds(node) : node->bounds;
+}
+
+Rectangle CguiGetNodeOpaqueBounds(CguiNode *node)
+{
+    if (!node || !node->opaqueBounds)
+    {
+        return (Rectangle) { 0 };
+    }
+
+    return node->opaqueBounds(node);
+}
+
+Rectangle CguiClipNodeChildren(CguiNode *node, Rectangle clip)
+{
+    if (!node || !node->clipChildren)
+    {
+        return clip;
+    }
+
+    float left   = fmaxf(node->bounds.x, clip.x);
+    float top    = fmaxf(node->bounds.y, clip.y);
+    float right  = fminf(node->bounds.x + node->bounds.width, clip.x + clip.width);
+    float bottom = fminf(node->bounds.y + node->bounds.height, clip.y + clip.height);
+
+    return (Rectangle) { left, top, fmaxf(right - left, 0.0f), fmaxf(bottom - top, 0.0f) };
+}
+
+bool CguiIsNodeCulled(CguiNode *node, Rectangle clip, bool *cullChildren)
+{
+    bool culled = node && !CheckCollisionRecs(CguiGetNodeVisualBounds(node), clip);
+
+    if (cullChildren)
+    {
+        *cullChildren = culled && (node->cullChildren || node->clipChildren);
+    }
+
+    return culled;
+}
+
+// Maximum number of opaque areas tracked in the occlusion pass
+#ifndef CGUI_OCCLUDERS_MAX
+#define CGUI_OCCLUDERS_MAX 8
+#endif
+
+// Collect visible node in draw order for the occlusion pass
+static void CguiCollectOcclusionNode(CguiNode *node)
+{
+    // Resize capacity if full (never shrinks, the array is reused)
+    if (cguiOcclusionNodesCount == cguiOcclusionNodesCapacity)
+    {
+        int        newCapacity = (cguiOcclusionNodesCapacity == 0) ? 64 : (cguiOcclusionNodesCapacity * 2);
+        CguiNode **newNodes    = CG_REALLOC(cguiOcclusionNodes, sizeof(CguiNode *) * newCapacity);
+        if (!newNodes)
+        {
+            // Missing the later nodes only leaves fewer occluders
+            return;
+        }
+
+        cguiOcclusionNodes         = newNodes;
+        cguiOcclusionNodesCapacity = newCapacity;
+    }
+
+    cguiOcclusionNodes[cguiOcclusionNodesCount++] = node;
+}
+
+// Opaque area of the node within the clipping ancestors and the scissor area
+static Rectangle CguiGetOccluderBounds(CguiNode *node)
+{
+    Rectangle area = GetCollisionRec(CguiGetNodeOpaqueBounds(node), CguiGetScissorRec());
+
+    for (CguiNode *parent = node->parent; parent && area.width > 0.0f && area.height > 0.0f; parent = parent->parent)
+    {
+        if (parent->clipChildren) area = GetCollisionRec(area, parent->bounds);
+    }
+
+    return area;
+}
+
+static bool CguiIsRectangleInside(Rectangle rec, Rectangle area)
+{
+    return rec.x >= area.x && rec.y >= area.y && rec.x + rec.width <= area.x + area.width && rec.y + rec.height <= area.y + area.height;
+}
+
+void CguiOccludeNodes(CguiNode *const *nodes, int count)
+{
+    if (!nodes)
+    {
+        return;
+    }
+
+    Rectangle occluders[CGUI_OCCLUDERS_MAX];
+    float     occluderAreas[CGUI_OCCLUDERS_MAX];
+    int       occludersCount = 0;
+
+    // Reverse draw order, occluders are always drawn later
+    for (int i = count - 1; i >= 0; i--)
+    {
+        CguiNode *current = nodes[i];
+        current->occluded = false;
+
+        // Post-draw may restore state of the pre-draw, never skip just one
+        if (current->drawPre && !current->drawPost && occludersCount > 0)
+        {
+            Rectangle visualBounds = CguiGetNodeVisualBounds(current);
+            for (int j = 0; j < occludersCount; j++)
+            {
+                if (CguiIsRectangleInside(visualBounds, occluders[j]))
+                {
+                    current->occluded = true;
+                    break;
+                }
+            }
+        }
+
+        if (!current->opaqueBounds || current->occluded)
+        {
+            continue;
+        }
+
+        Rectangle area     = CguiGetOccluderBounds(current);
+        float     areaSize = area.width * area.height;
+        if (area.width <= 0.0f || area.height <= 0.0f)
+        {
+            continue;
+        }
+
+        // Keep the largest occluders
+        int slot = occludersCount;
+        if (occludersCount == CGUI_OCCLUDERS_MAX)
+        {
+            slot = 0;
+            for (int j = 1; j < occludersCount; j++)
+            {
+                if (occluderAreas[j] < occluderAreas[slot]) slot = j;
+            }
+
+            if (occluderAreas[slot] >= areaSize)
+            {
+                continue;
+            }
+        }
+        else
+        {
+            occludersCount++;
+        }
+
+        occluders[slot]     = area;
+        occluderAreas[slot] = areaSize;
+    }
+}
+
+// Mark the visible nodes covered by the opaque areas of nodes drawn after them
+static void CguiOccludeNode(CguiNode *node)
+{
+    cguiOcclusionNodesCount = 0;
+    CguiTraverseNode(node, CguiCollectOcclusionNode, NULL, true);
+    CguiOccludeNodes(cguiOcclusionNodes, cguiOcclusionNodesCount);
+    cguiOcclusionNodesCount = 0;
+}
+
+// Pre-draw the node unless it is occluded (the mark is consumed)
+static void CguiDrawPreNodeVisible(CguiNode *node)
+{
+    bool occluded  = node->occluded;
+    node->occluded = false;
+
+    if (!occluded) CguiDrawPreNodeSelf(node);
+}
+
+// Next node after the node in pre-order (parent first) within the root, NULL if none
+static CguiNode *CguiNextNodeInTree(CguiNode *root, CguiNode *node)
+{
+    if (node->childrenCount > 0)
+    {
+        return node->children[0];
+    }
+
+    for (; node != root && node->parent; node = node->parent)
+    {
+        if (node->childIndex + 1 < node->parent->childrenCount)
+        {
+            return node->parent->children[node->childIndex + 1];
+        }
+    }
+
+    return NULL;
+}
+
+// Node index
+// Names are stored in a linear probing hash table with backward shift deletion
+// (no tombstones), types in a linear probing hash table of intrusive lists.
+
+// Index the node is in (also the index of its children)
+static CguiNodeIndex *CguiFindIndexOf(CguiNode *node)
+{
+    return node ? node->index : NULL;
+}
+
+// Whether the node is the root of its index
+static bool CguiIsIndexRoot(CguiNode *node)
+{
+    return node->index && node->index->root == node;
+}
+
+// FNV-1a
+static unsigned int CguiHashName(const char *name)
+{
+    unsigned int hash = 2166136261u;
+    for (; *name; name++)
+    {
+        hash = (hash ^ (unsigned char) *name) * 16777619u;
+    }
+
+    return hash;
+}
+
+static unsigned int CguiHashType(int type)
+{
+    return (unsigned int) type * 2654435761u;
+}
+
+static void CguiInsertIndexName(CguiNodeIndex *index, CguiNode *node)
+{
+    unsigned int mask = index->namesCapacity - 1;
+    unsigned int i    = CguiHashName(node->name) & mask;
+    while (index->names[i])
+    {
+        i = (i + 1) & mask;
+    }
+
+    index->names[i] = node;
+    index->namesCount++;
+}
+
+static bool CguiSetIndexNamesCapacity(CguiNodeIndex *index, int newCapacity)
+{
+    CguiNode **oldNames    = index->names;
+    int        oldCapacity = index->namesCapacity;
+
+    CguiNode **newNames = CG_MALLOC_NULL(sizeof(CguiNode *) * newCapacity);
+    if (!newNames)
+    {
+        return false;
+    }
+
+    index->names         = newNames;
+    index->namesCount    = 0;
+    index->namesCapacity = newCapacity;
+
+    for (int i = 0; i < oldCapacity; i++)
+    {
+        if (oldNames[i])
+        {
+            CguiInsertIndexName(index, oldNames[i]);
+        }
+    }
+
+    CG_FREE_NULL(oldNames);
+    return true;
+}
+
+static CguiNodeIndexType *CguiGetIndexType(CguiNodeIndex *index, int type, bool create)
+{
+    if (index->typesCapacity > 0)
+    {
+        unsigned int mask = index->typesCapacity - 1;
+        for (unsigned int i = CguiHashType(type) & mask; index->types[i].used; i = (i + 1) & mask)
+        {
+            if (index->types[i].type == type)
+            {
+                return &index->types[i];
+            }
+        }
+    }
+
+    if (!create)
+    {
+        return NULL;
+    }
+
+    // Resize capacity if >= 50% used
+    if ((index->typesCount + 1) * 2 > index->typesCapacity)
+    {
+        int                newCapacity = (index->typesCapacity == 0) ? 16 : (index->typesCapacity * 2);
+        CguiNodeIndexType *newTypes    = CG_MALLOC_NULL(sizeof(CguiNodeIndexType) * newCapacity);
+        if (!newTypes)
+        {
+            return NULL;
+        }
+
+        // Types are never removed, rehash as-is
+        for (int i = 0; i < index->typesCapacity; i++)
+        {
+            if (index->types[i].used)
+            {
+                unsigned int j = CguiHashType(index->types[i].type) & (newCapacity - 1);
+                while (newTypes[j].used)
+                {
+                    j = (j + 1) & (newCapacity - 1);
+                }
+
+                newTypes[j] = index->types[i];
+            }
+        }
+
+        CG_FREE_NULL(index->types);
+        index->types         = newTypes;
+        index->typesCapacity = newCapacity;
+    }
+
+    unsigned int mask = index->typesCapacity - 1;
+    unsigned int i    = CguiHashType(type) & mask;
+    while (index->types[i].used)
+    {
+        i = (i + 1) & mask;
+    }
+
+    index->types[i] = (CguiNodeIndexType) { .used = true, .type = type };
+    index->typesCount++;
+
+    return &index->types[i];
+}
+
+static void CguiIndexNode(CguiNodeIndex *index, CguiNode *node)
+{
+    node->index = index;
+
+    if (node->name)
+    {
+        // Resize capacity if >= 50% used
+        if ((index->namesCount + 1) * 2 > index->namesCapacity && !CguiSetIndexNamesCapacity(index, (index->namesCapacity == 0) ? 64 : (index->namesCapacity * 2)))
+        {
+            CG_LOG_ERROR("Failed to index node name: %s", node->name);
+        }
+        else
+        {
+            CguiInsertIndexName(index, node);
+        }
+    }
+
+    CguiNodeIndexType *entry = CguiGetIndexType(index, node->type, true);
+    if (!entry)
+    {
+        CG_LOG_ERROR("Failed to index node type: %s", node->name);
+        return;
+    }
+
+    // Order does not matter, insert at front
+    node->prevOfType = NULL;
+    node->nextOfType = entry->first;
+    if (entry->first) entry->first->prevOfType = node;
+    entry->first = node;
+    entry->count++;
+}
+
+static void CguiUnindexNode(CguiNodeIndex *index, CguiNode *node)
+{
+    node->index = NULL;
+
+    if (node->name && index->namesCapacity > 0)
+    {
+        unsigned int mask = index->namesCapacity - 1;
+        unsigned int i    = CguiHashName(node->name) & mask;
+        while (index->names[i] && index->names[i] != node)
+        {
+            i = (i + 1) & mask;
+        }
+
+        if (index->names[i])
+        {
+            // Shift back the following entries that would become unreachable
+            for (unsigned int j = (i + 1) & mask; index->names[j]; j = (j + 1) & mask)
+            {
+                unsigned int home = CguiHashName(index->names[j]->name) & mask;
+                if (((j - home) & mask) >= ((j - i) & mask))
+                {
+                    index->names[i] = index->names[j];
+                    i               = j;
+                }
+            }
+
+            index->names[i] = NULL;
+            index->namesCount--;
+        }
+    }
+
+    CguiNodeIndexType *entry = CguiGetIndexType(index, node->type, false);
+    if (!entry)
+    {
+        return;
+    }
+
+    if (node->prevOfType)
+    {
+        node->prevOfType->nextOfType = node->nextOfType;
+    }
+    else if (entry->first == node)
+    {
+        entry->first = node->nextOfType;
+    }
+    else
+    {
+        // Not in the index
+        return;
+    }
+
+    if (node->nextOfType) node->nextOfType->prevOfType = node->prevOfType;
+
+    node->prevOfType = NULL;
+    node->nextOfType = NULL;
+    entry->count--;
+}
+
+// Remove all the nodes from the index without visiting them, and detach it from its root
+static void CguiClearNodeIndex(CguiNodeIndex *index)
+{
+    if (index->names) memset(index->names, 0, sizeof(CguiNode *) * index->namesCapacity);
+    if (index->types) memset(index->types, 0, sizeof(CguiNodeIndexType) * index->typesCapacity);
+
+    index->namesCount = 0;
+    index->typesCount = 0;
+    index->root       = NULL;
+}
+
+// Add or remove node and all its children to/from the index
+static void CguiIndexSubtree(CguiNodeIndex *index, CguiNode *node, bool add)
+{
+    int base = cguiTraversalStackCount;
+    if (!CguiPushTraversal(node, 0, false))
+    {
+        return;
+    }
+
+    while (cguiTraversalStackCount > base)
+    {
+        CguiNode *current = cguiTraversalStack[--cguiTraversalStackCount].node;
+
+        if (add)
+        {
+            // Indexed tree is merged, its index is left empty
+            if (current->index && current->index != index && CguiIsIndexRoot(current))
+            {
+                CguiClearNodeIndex(current->index);
+            }
+
+            CguiIndexNode(index, current);
+        }
+        else
+        {
+            CguiUnindexNode(index, current);
+        }
+
+        for (int i = 0; i < current->childrenCount; i++)
+        {
+            if (!CguiPushTraversal(current->children[i], 0, false))
+            {
+                cguiTraversalStackCount = base;
+                return;
+            }
+        }
+    }
+}
+
+CguiNodeIndex *CguiCreateNodeIndex(CguiNode *root)
+{
+    if (!root || root->index)
+    {
+        return NULL;
+    }
+
+    CguiNodeIndex *index = CG_MALLOC_NULL(sizeof(CguiNodeIndex));
+    if (!index)
+    {
+        return NULL;
+    }
+
+    index->root = root;
+    CguiIndexSubtree(index, root, true);
+
+    CG_LOG_TRACE("Created index of %s: %d names, %d types", root->name, index->namesCount, index->typesCount);
+
+    return index;
+}
+
+void CguiDeleteNodeIndex(CguiNodeIndex *index)
+{
+    if (!index)
+    {
+        return;
+    }
+
+    if (index->root)
+    {
+        CguiIndexSubtree(index, index->root, false);
+    }
+
+    CG_FREE_NULL(index->names);
+    CG_FREE_NULL(index->types);
+    CG_FREE_NULL(index);
+}
+
+CguiNode *CguiFindNodeByName(CguiNode *root, const char *name)
+{
+    if (!root || !name)
+    {
+        return NULL;
+    }
+
+    if (CguiIsIndexRoot(root))
+    {
+        CguiNodeIndex *index = root->index;
+        if (index->namesCapacity == 0)
+        {
+            return NULL;
+        }
+
+        unsigned int mask = index->namesCapacity - 1;
+        for (unsigned int i = CguiHashName(name) & mask; index->names[i]; i = (i + 1) & mask)
+        {
+            if (strcmp(index->names[i]->name, name) == 0)
+            {
+                return index->names[i];
+            }
+        }
+
+        return NULL;
+    }
+
+    // Not indexed, search the tree
+    for (CguiNode *node = root; node; node = CguiNextNodeInTree(root, node))
+    {
+        if (node->name && strcmp(node->name, name) == 0)
+        {
+            return node;
+        }
+    }
+
+    return NULL;
+}
+
+CguiNode *CguiFindFirstNodeOfType(CguiNode *root, int type)
+{
+    if (!root)
+    {
+        return NULL;
+    }
+
+    if (CguiIsIndexRoot(root))
+    {
+        CguiNodeIndexType *entry = CguiGetIndexType(root->index, type, false);
+        return entry ? entry->first : NULL;
+    }
+
+    // Not indexed, search the tree
+    for (CguiNode *node = root; node; node = CguiNextNodeInTree(root, node))
+    {
+        if (node->type == type)
+        {
+            return node;
+        }
+    }
+
+    return NULL;
+}
+
+CguiNode *CguiFindNextNodeOfType(CguiNode *root, CguiNode *node)
+{
+    if (!root || !node)
+    {
+        return NULL;
+    }
+
+    if (CguiIsIndexRoot(root))
+    {
+        return node->nextOfType;
+    }
+
+    // Not indexed, continue searching the tree
+    for (CguiNode *next = CguiNextNodeInTree(root, node); next; next = CguiNextNodeInTree(root, next))
+    {
+        if (next->type == node->type)
+        {
+            return next;
+        }
+    }
+
+    return NULL;
+}
 
 // Node management
 
@@ -101,6 +943,177 @@ CguiNode *CguiCreateNodeProMax(CguiTransformation transformation, const char *na
     return node;
 }
 
+// Detach all the remaining instances of a template, making them standalone nodes
+static void CguiDetachInstances(CguiNode *templateNode)
+{
+    for (int i = 0; i < templateNode->instancesCount; i++)
+    {
+        templateNode->instances[i]->templateSource = NULL;
+        templateNode->instances[i]->instanceIndex  = 0;
+    }
+
+    CG_FREE_NULL(templateNode->instances);
+    templateNode->instancesCount    = 0;
+    templateNode->instancesCapacity = 0;
+}
+
+// Reduce instances capacity until it is >= 25% used, in one reallocation
+static void CguiFitInstancesCapacity(CguiNode *templateNode)
+{
+    int newCapacity = templateNode->instancesCapacity;
+    while (newCapacity > 1 && templateNode->instancesCount < newCapacity / 4)
+    {
+        newCapacity /= 2;
+    }
+
+    if (newCapacity != templateNode->instancesCapacity)
+    {
+        // Ignore reallocation failure
+        CguiSetInstancesCapacity(templateNode, newCapacity);
+    }
+}
+
+// Remove a node from the deletion queue, preserving the order of the queue
+static void CguiUnqueueDeleteNode(CguiNode *node)
+{
+    for (int i = 0; i < cguiDeleteQueueCount; i++)
+    {
+        if (cguiDeleteQueue[i] == node)
+        {
+            memmove(&cguiDeleteQueue[i], &cguiDeleteQueue[i + 1], sizeof(CguiNode *) * (cguiDeleteQueueCount - i - 1));
+            cguiDeleteQueueCount--;
+            break;
+        }
+    }
+
+    node->deleteQueued = false;
+}
+
+// Delete a subtree node by node, without the traversal stack
+static void CguiDeleteSubtreeRecursive(CguiNode *node)
+{
+    for (int i = 0; i < node->childrenCount; i++)
+    {
+        node->children[i]->parent = NULL; // Optimization: reduce unnecessary searching for child in current and unnecessary reallocations when deleting
+        CguiDeleteSubtreeRecursive(node->children[i]);
+    }
+
+    CG_FREE_NULL(node->children);
+    node->childrenCount = 0;
+
+    CguiDeleteNodeSelf(node);
+}
+
+// Delete all the subtrees whose roots are in the traversal stack above base
+// Roots must already be detached from their parent
+static void CguiDeleteSubtrees(int base)
+{
+    // Collect the whole subtrees, parents before children (nothing is modified until all are collected)
+    int rootsEnd = cguiTraversalStackCount;
+    for (int i = base; i < cguiTraversalStackCount; i++)
+    {
+        CguiNode *node = cguiTraversalStack[i].node;
+        for (int j = 0; j < node->childrenCount; j++)
+        {
+            if (!CguiPushTraversal(node->children[j], 0, false))
+            {
+                // Note: The stack cannot grow, the subtrees are still whole, so delete them node by node
+                cguiTraversalStackCount = rootsEnd;
+                while (cguiTraversalStackCount > base)
+                {
+                    CguiDeleteSubtreeRecursive(cguiTraversalStack[--cguiTraversalStackCount].node);
+                }
+
+                return;
+            }
+        }
+    }
+
+    for (int i = rootsEnd; i < cguiTraversalStackCount; i++)
+    {
+        cguiTraversalStack[i].node->parent = NULL; // Optimization: reduce unnecessary searching for child in current and unnecessary reallocations when deleting
+    }
+
+    // Delete node data, children before their parent
+    for (int i = cguiTraversalStackCount - 1; i >= base; i--)
+    {
+        CguiNode *node = cguiTraversalStack[i].node;
+
+        CG_LOG_TRACE("Deleted node: %s", node->name);
+
+        if (node->deleteNodeData)
+        {
+            node->deleteNodeData(node);
+        }
+    }
+
+    // Deleted templates release all their instances at once
+    for (int i = base; i < cguiTraversalStackCount; i++)
+    {
+        CguiNode *node = cguiTraversalStack[i].node;
+        if (node->instancesCount > 0)
+        {
+            CguiDetachInstances(node);
+        }
+    }
+
+    // Unlink from surviving templates without reducing their capacity
+    for (int i = base; i < cguiTraversalStackCount; i++)
+    {
+        CguiNode *node           = cguiTraversalStack[i].node;
+        CguiNode *templateSource = node->templateSource;
+        if (!templateSource)
+        {
+            continue;
+        }
+
+        // Order does not matter, move the last element in place of removed element
+        CguiNode *last                                 = templateSource->instances[templateSource->instancesCount - 1];
+        templateSource->instances[node->instanceIndex] = last;
+        last->instanceIndex                            = node->instanceIndex;
+        templateSource->instancesCount--;
+    }
+
+    // Reduce capacity of surviving templates once
+    for (int i = base; i < cguiTraversalStackCount; i++)
+    {
+        CguiNode *node = cguiTraversalStack[i].node;
+        if (node->templateSource)
+        {
+            CguiFitInstancesCapacity(node->templateSource);
+            node->templateSource = NULL;
+        }
+    }
+
+    // Deallocate everything in one sweep
+    for (int i = base; i < cguiTraversalStackCount; i++)
+    {
+        CguiNode *node = cguiTraversalStack[i].node;
+
+        // Do not leave references to deleted nodes behind
+        if (node->deleteQueued)
+        {
+            CguiUnqueueDeleteNode(node);
+        }
+
+        if (CguiIsIndexRoot(node))
+        {
+            node->index->root = NULL;
+        }
+
+        CguiReleaseNodeHandle(node);
+
+        CG_FREE_NULL(node->children);
+        CG_FREE_NULL(node->instances);
+        CG_FREE_NULL(node->name);
+        CG_FREE_NULL(node->data);
+        CG_FREE_NULL(node->instanceData);
+        CG_FREE_NULL(node);
+    }
+
+    cguiTraversalStackCount = base;
+}
+
 void CguiDeleteNode(CguiNode *node)
 {
     if (!node)
@@ -108,20 +1121,129 @@ void CguiDeleteNode(CguiNode *node)
         return;
     }
 
-    if (node->children)
+    // Detach from parent if it is still attached
+    if (node->parent)
+    {
+        CguiRemoveChild(node->parent, node);
+    }
+
+    int base = cguiTraversalStackCount;
+    if (!CguiPushTraversal(node, 0, false))
+    {
+        CguiDeleteSubtreeRecursive(node);
+        return;
+    }
+
+    CguiDeleteSubtrees(base);
+}
+
+bool CguiQueueDeleteNode(CguiNode *node)
+{
+    if (!node)
+    {
+        return false;
+    }
+
+    // Already queued
+    if (node->deleteQueued)
+    {
+        return true;
+    }
+
+    // Resize capacity if full
+    if (cguiDeleteQueueCount == cguiDeleteQueueCapacity)
     {
-        for (int i = node->childrenCount - 1; i >= 0; i--)
+        int        newCapacity = (cguiDeleteQueueCapacity == 0) ? 16 : (cguiDeleteQueueCapacity * 2);
+        CguiNode **newQueue    = CG_REALLOC(cguiDeleteQueue, sizeof(CguiNode *) * newCapacity);
+        if (!newQueue)
         {
-            node->children[i]->parent = NULL; // Optimization: reduce unnecessary searching for child in current and unnecessary reallocations when deleting
-            CguiDeleteNode(node->children[i]);
+            return false;
         }
 
-        CG_FREE_NULL(node->children);
-        node->childrenCount    = 0;
-        node->childrenCapacity = 0;
+        cguiDeleteQueue         = newQueue;
+        cguiDeleteQueueCapacity = newCapacity;
     }
 
-    CguiDeleteNodeSelf(node);
+    cguiDeleteQueue[cguiDeleteQueueCount++] = node;
+
+    node->deleteQueued = true;
+    node->enabled      = false;
+
+    // Compiled trees keep the enabled state in their records
+    cguiTreeVersion++;
+
+    return true;
+}
+
+int CguiFlushDeleteQueue(int maxCount)
+{
+    if (cguiDeleteQueueCount == 0)
+    {
+        return 0;
+    }
+
+    // Queued children are deleted along with their queued parent
+    int count = 0;
+    for (int i = 0; i < cguiDeleteQueueCount; i++)
+    {
+        CguiNode *node    = cguiDeleteQueue[i];
+        bool      covered = false;
+
+        for (CguiNode *parent = node->parent; parent; parent = parent->parent)
+        {
+            if (parent->deleteQueued)
+            {
+                covered = true;
+                break;
+            }
+        }
+
+        if (covered)
+        {
+            node->deleteQueued = false;
+            continue;
+        }
+
+        cguiDeleteQueue[count++] = node;
+    }
+
+    cguiDeleteQueueCount = count;
+
+    // Oldest queued nodes are deleted first
+    int deleteCount = (maxCount > 0 && maxCount < cguiDeleteQueueCount) ? maxCount : cguiDeleteQueueCount;
+    int base        = cguiTraversalStackCount;
+
+    for (int i = 0; i < deleteCount; i++)
+    {
+        if (!CguiPushTraversal(cguiDeleteQueue[i], 0, false))
+        {
+            // Try again next time
+            cguiTraversalStackCount = base;
+            return cguiDeleteQueueCount;
+        }
+    }
+
+    // Take them out of the queue before deleting, delete functions may queue more nodes
+    memmove(cguiDeleteQueue, &cguiDeleteQueue[deleteCount], sizeof(CguiNode *) * (cguiDeleteQueueCount - deleteCount));
+    cguiDeleteQueueCount -= deleteCount;
+
+    for (int i = base; i < cguiTraversalStackCount; i++)
+    {
+        CguiNode *node     = cguiTraversalStack[i].node;
+        node->deleteQueued = false;
+
+        // Detach from parent if it is still attached
+        if (node->parent)
+        {
+            CguiRemoveChild(node->parent, node);
+        }
+    }
+
+    CguiDeleteSubtrees(base);
+
+    CG_LOG_TRACE("Deleted %d queued nodes, %d left in queue", deleteCount, cguiDeleteQueueCount);
+
+    return cguiDeleteQueueCount;
 }
 
 void CguiDeleteNodeSelf(CguiNode *node)
@@ -138,45 +1260,169 @@ void CguiDeleteNodeSelf(CguiNode *node)
         node->deleteNodeData(node);
     }
 
-    // Detach from parent if it is still attached
-    if (node->parent)
+    // Do not leave references to deleted node behind
+    if (node->deleteQueued)
+    {
+        CguiUnqueueDeleteNode(node);
+    }
+
+    // Detach from parent if it is still attached
+    if (node->parent)
+    {
+        CguiRemoveChild(node->parent, node);
+    }
+
+    // Unlink from template source if it is still linked
+    if (node->templateSource)
+    {
+        CguiUnlinkTemplate(node);
+    }
+
+    // Remaining instances become standalone nodes
+    if (node->instances)
+    {
+        CguiDetachInstances(node);
+    }
+
+    CguiReleaseNodeHandle(node);
+
+    if (CguiIsIndexRoot(node))
+    {
+        node->index->root = NULL;
+    }
+
+    CG_FREE_NULL(node->name);
+
+    CG_FREE_NULL(node->data);
+    node->dataSize = 0;
+
+    CG_FREE_NULL(node->instanceData);
+    node->instanceDataSize = 0;
+
+    CG_FREE_NULL(node);
+}
+
+bool CguiRenameNode(CguiNode *node, const char *newName)
+{
+    if (!node)
+    {
+        return false;
+    }
+
+    // Re-index with the new name
+    CguiNodeIndex *index = CguiFindIndexOf(node);
+    if (index)
+    {
+        CguiUnindexNode(index, node);
+    }
+
+    char *name = CG_REALLOC(node->name, strlen(newName) + 1);
+    if (name)
+    {
+        node->name = name;
+        strcpy(node->name, newName);
+    }
+
+    if (index)
+    {
+        CguiIndexNode(index, node);
+    }
+
+    return name != NULL;
+}
+
+// Compute bounds of all children in batch if they are all going to be rebounded
+// Children must not have transform function, as the order of transform function calls must be preserved
+static void CguiTransformChildrenBatch(CguiTraversalEntry *entry)
+{
+    CguiNode *node  = entry->node;
+    int       count = node->childrenCount;
+
+    if (!entry->flag || count < CGUI_BOUNDS_BATCH_THRESHOLD)
+    {
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
     {
-        CguiRemoveChild(node->parent, node);
+        if (!node->children[i] || node->children[i]->transform)
+        {
+            return;
+        }
     }
 
-    // Unlink from template source if it is still linked
-    if (node->templateSource)
+    // 6 arrays of inputs, 2 of parent bounds, 2 of outputs, reused for both axes
+    if (cguiBoundsBatchCapacity < count)
     {
-        CguiUnlinkTemplate(node);
+        float *newBatch = CG_REALLOC(cguiBoundsBatch, sizeof(float) * 10 * count);
+        if (!newBatch)
+        {
+            return; // Fallback to computing individually
+        }
+
+        cguiBoundsBatch         = newBatch;
+        cguiBoundsBatchCapacity = count;
     }
 
-    CG_FREE_NULL(node->name);
+    float *position           = cguiBoundsBatch;
+    float *size               = position + count;
+    float *isRelativePosition = size + count;
+    float *isRelativeSize     = isRelativePosition + count;
+    float *anchor             = isRelativeSize + count;
+    float *shrink             = anchor + count;
+    float *pPosition          = shrink + count;
+    float *pSize              = pPosition + count;
+    float *outPosition        = pSize + count;
+    float *outSize            = outPosition + count;
 
-    CG_FREE_NULL(node->data);
-    node->dataSize = 0;
+    Rectangle pBounds = node->bounds;
 
-    CG_FREE_NULL(node->instanceData);
-    node->instanceDataSize = 0;
+    // X-axis
+    for (int i = 0; i < count; i++)
+    {
+        CguiTransformation *t = &node->children[i]->transformation;
+        position[i]           = t->position.x;
+        size[i]               = t->size.x;
+        isRelativePosition[i] = t->isRelativePosition.x;
+        isRelativeSize[i]     = t->isRelativeSize.x;
+        anchor[i]             = t->anchor.x;
+        shrink[i]             = t->shrink.x;
+        pPosition[i]          = pBounds.x;
+        pSize[i]              = pBounds.width;
+    }
 
-    CG_FREE_NULL(node);
-}
+    CguiComputeBoundsAxisBatch(position, size, isRelativePosition, isRelativeSize, anchor, shrink, pPosition, pSize, outPosition, outSize, count);
 
-bool CguiRenameNode(CguiNode *node, const char *newName)
-{
-    if (!node)
+    for (int i = 0; i < count; i++)
     {
-        return false;
+        node->children[i]->bounds.x     = outPosition[i];
+        node->children[i]->bounds.width = outSize[i];
     }
 
-    char *name = CG_REALLOC(node->name, strlen(newName) + 1);
-    if (!name)
+    // Y-axis
+    for (int i = 0; i < count; i++)
     {
-        return false;
+        CguiTransformation *t = &node->children[i]->transformation;
+        position[i]           = t->position.y;
+        size[i]               = t->size.y;
+        isRelativePosition[i] = t->isRelativePosition.y;
+        isRelativeSize[i]     = t->isRelativeSize.y;
+        anchor[i]             = t->anchor.y;
+        shrink[i]             = t->shrink.y;
+        pPosition[i]          = pBounds.y;
+        pSize[i]              = pBounds.height;
     }
 
-    node->name = name;
-    strcpy(node->name, newName);
-    return true;
+    CguiComputeBoundsAxisBatch(position, size, isRelativePosition, isRelativeSize, anchor, shrink, pPosition, pSize, outPosition, outSize, count);
+
+    for (int i = 0; i < count; i++)
+    {
+        node->children[i]->bounds.y      = outPosition[i];
+        node->children[i]->bounds.height = outSize[i];
+        node->children[i]->rebound       = false;
+    }
+
+    entry->batched = true;
 }
 
 void CguiTransformNode(CguiNode *node, bool rebound)
@@ -186,12 +1432,47 @@ void CguiTransformNode(CguiNode *node, bool rebound)
         return;
     }
 
+    int base = cguiTraversalStackCount;
+
     // Rebound propegates down the tree to all children
     rebound |= CguiTransformNodeSelf(node, rebound);
+    if (!CguiPushTraversal(node, 0, rebound))
+    {
+        return;
+    }
 
-    for (int i = 0; i < node->childrenCount; i++)
+    CguiTransformChildrenBatch(&cguiTraversalStack[cguiTraversalStackCount - 1]);
+
+    while (cguiTraversalStackCount > base)
     {
-        CguiTransformNode(node->children[i], rebound);
+        CguiTraversalEntry *top = &cguiTraversalStack[cguiTraversalStackCount - 1];
+
+        if (top->index >= top->node->childrenCount)
+        {
+            cguiTraversalStackCount--;
+            continue;
+        }
+
+        CguiNode *child        = top->node->children[top->index++];
+        bool      childRebound = top->flag;
+        if (!child)
+        {
+            continue;
+        }
+
+        // Batched children were rebounded already, unless modified since
+        if (!top->batched || child->transform || child->rebound)
+        {
+            childRebound |= CguiTransformNodeSelf(child, childRebound);
+        }
+
+        if (!CguiPushTraversal(child, 0, childRebound))
+        {
+            cguiTraversalStackCount = base;
+            return;
+        }
+
+        CguiTransformChildrenBatch(&cguiTraversalStack[cguiTraversalStackCount - 1]);
     }
 }
 
@@ -226,14 +1507,7 @@ void CguiUpdateNode(CguiNode *node)
         return;
     }
 
-    CguiUpdatePreNodeSelf(node);
-
-    for (int i = 0; i < node->childrenCount; i++)
-    {
-        CguiUpdateNode(node->children[i]);
-    }
-
-    CguiUpdatePostNodeSelf(node);
+    CguiTraverseNode(node, CguiUpdatePreNodeSelf, CguiUpdatePostNodeSelf, false);
 }
 
 void CguiUpdatePreNodeSelf(CguiNode *node)
@@ -269,14 +1543,8 @@ void CguiDrawNode(CguiNode *node)
         return;
     }
 
-    CguiDrawPreNodeSelf(node);
-
-    for (int i = 0; i < node->childrenCount; i++)
-    {
-        CguiDrawNode(node->children[i]);
-    }
-
-    CguiDrawPostNodeSelf(node);
+    CguiOccludeNode(node);
+    CguiTraverseNode(node, CguiDrawPreNodeVisible, CguiDrawPostNodeSelf, true);
 }
 
 void CguiDrawPreNodeSelf(CguiNode *node)
@@ -312,12 +1580,7 @@ void CguiDebugDrawNode(CguiNode *node)
         return;
     }
 
-    CguiDebugDrawNodeSelf(node);
-
-    for (int i = 0; i < node->childrenCount; i++)
-    {
-        CguiDebugDrawNode(node->children[i]);
-    }
+    CguiTraverseNode(node, CguiDebugDrawNodeSelf, NULL, false);
 }
 
 void CguiDebugDrawNodeSelf(CguiNode *node)
@@ -374,7 +1637,8 @@ CguiNode *CguiCloneNode(CguiNode *node)
                 return NULL;
             }
 
-            newNode->children[i]->parent = newNode;
+            newNode->children[i]->parent     = newNode;
+            newNode->children[i]->childIndex = i;
         }
     }
 
@@ -440,7 +1704,8 @@ CguiNode *CguiCreateInstance(CguiNode *templateNode)
                 return NULL;
             }
 
-            instance->children[i]->parent = instance;
+            instance->children[i]->parent     = instance;
+            instance->children[i]->childIndex = i;
         }
     }
 
@@ -516,8 +1781,9 @@ bool CguiLinkTemplate(CguiNode *node, CguiNode *templateNode)
 
     // Order does not matter, insert at end
     templateNode->instances[templateNode->instancesCount] = node;
-    templateNode->instancesCount++;
     node->templateSource = templateNode;
+    node->instanceIndex  = templateNode->instancesCount;
+    templateNode->instancesCount++;
 
     return true;
 }
@@ -538,8 +1804,10 @@ bool CguiUnlinkTemplate(CguiNode *node)
     CguiNode *templateSource = node->templateSource;
     node->templateSource     = NULL;
 
-    // Shift element left to remove element
-    memmove(&templateSource->instances[foundInstanceIndex], &templateSource->instances[foundInstanceIndex + 1], sizeof(CguiNode *) * (templateSource->instancesCount - foundInstanceIndex));
+    // Order does not matter, move the last element in place of removed element
+    CguiNode *last                                = templateSource->instances[templateSource->instancesCount - 1];
+    templateSource->instances[foundInstanceIndex] = last;
+    last->instanceIndex                           = foundInstanceIndex;
     templateSource->instancesCount--;
 
     // Reduce capacity if < 25% used
@@ -583,6 +1851,20 @@ int CguiFindInstanceIndex(CguiNode *templateSource, CguiNode *instance)
         return -1;
     }
 
+    // Optimization: Use the back-index of the linked instance
+    if (instance->templateSource == templateSource &&
+        instance->instanceIndex >= 0 && instance->instanceIndex < templateSource->instancesCount &&
+        templateSource->instances[instance->instanceIndex] == instance)
+    {
+        return instance->instanceIndex;
+    }
+
+    // Optimization: Unlinked node cannot be an instance
+    if (!instance->templateSource)
+    {
+        return -1;
+    }
+
     for (int i = 0; i < templateSource->instancesCount; i++)
     {
         if (templateSource->instances[i] == instance)
@@ -601,11 +1883,36 @@ void CguiSyncInstances(CguiNode *node, bool resync)
         return;
     }
 
+    int base = cguiTraversalStackCount;
+
     bool instanceResync = CguiSyncInstancesSelf(node, resync);
+    if (!CguiPushTraversal(node, 0, instanceResync))
+    {
+        return;
+    }
 
-    for (int i = 0; i < node->instancesCount; i++)
+    while (cguiTraversalStackCount > base)
     {
-        CguiSyncInstances(node->instances[i], instanceResync);
+        CguiTraversalEntry *top = &cguiTraversalStack[cguiTraversalStackCount - 1];
+
+        if (top->index >= top->node->instancesCount)
+        {
+            cguiTraversalStackCount--;
+            continue;
+        }
+
+        CguiNode *instance = top->node->instances[top->index++];
+        if (!instance)
+        {
+            continue;
+        }
+
+        instanceResync = CguiSyncInstancesSelf(instance, top->flag);
+        if (!CguiPushTraversal(instance, 0, instanceResync))
+        {
+            cguiTraversalStackCount = base;
+            return;
+        }
     }
 }
 
@@ -645,11 +1952,36 @@ void CguiSyncHierarchy(CguiNode *node)
         return;
     }
 
+    int base = cguiTraversalStackCount;
+
     CguiSyncInstances(node, node->resync);
+    if (!CguiPushTraversal(node, 0, false))
+    {
+        return;
+    }
 
-    for (int i = 0; i < node->childrenCount; i++)
+    while (cguiTraversalStackCount > base)
     {
-        CguiSyncHierarchy(node->children[i]);
+        CguiTraversalEntry *top = &cguiTraversalStack[cguiTraversalStackCount - 1];
+
+        if (top->index >= top->node->childrenCount)
+        {
+            cguiTraversalStackCount--;
+            continue;
+        }
+
+        CguiNode *child = top->node->children[top->index++];
+        if (!child)
+        {
+            continue;
+        }
+
+        CguiSyncInstances(child, child->resync);
+        if (!CguiPushTraversal(child, 0, false))
+        {
+            cguiTraversalStackCount = base;
+            return;
+        }
     }
 }
 
@@ -693,8 +2025,22 @@ bool CguiInsertChildAt(CguiNode *parent, CguiNode *child, int childIndex)
 
     parent->children[childIndex] = child;
     parent->childrenCount++;
-    parent->rebound = true;
-    child->parent   = parent;
+    parent->rebound   = true;
+    child->parent     = parent;
+    child->childIndex = childIndex;
+
+    // Update back-indices of shifted elements
+    for (int i = childIndex + 1; i < parent->childrenCount; i++)
+    {
+        parent->children[i]->childIndex = i;
+    }
+    cguiTreeVersion++;
+
+    CguiNodeIndex *index = CguiFindIndexOf(parent);
+    if (index)
+    {
+        CguiIndexSubtree(index, child, true);
+    }
 
     return true;
 }
@@ -717,13 +2063,26 @@ bool CguiRemoveChildAt(CguiNode *parent, int childIndex)
         return false;
     }
 
+    CguiNodeIndex *index = CguiFindIndexOf(parent);
+    if (index)
+    {
+        CguiIndexSubtree(index, parent->children[childIndex], false);
+    }
+
     parent->children[childIndex]->parent = NULL;
 
     // Shift elements left to remove element
-    memmove(&parent->children[childIndex], &parent->children[childIndex + 1], sizeof(CguiNode *) * (parent->childrenCount - childIndex));
+    memmove(&parent->children[childIndex], &parent->children[childIndex + 1], sizeof(CguiNode *) * (parent->childrenCount - childIndex - 1));
     parent->childrenCount--;
     parent->rebound = true;
 
+    // Update back-indices of shifted elements
+    for (int i = childIndex; i < parent->childrenCount; i++)
+    {
+        parent->children[i]->childIndex = i;
+    }
+    cguiTreeVersion++;
+
     // Reduce capacity if < 25% used
     if (parent->childrenCapacity > 1 && parent->childrenCount < parent->childrenCapacity / 4)
     {
@@ -814,14 +2173,21 @@ bool CguiRemoveAllChildren(CguiNode *parent)
         return false;
     }
 
+    CguiNodeIndex *index = CguiFindIndexOf(parent);
     for (int i = 0; i < parent->childrenCount; i++)
     {
+        if (index)
+        {
+            CguiIndexSubtree(index, parent->children[i], false);
+        }
+
         parent->children[i]->parent = NULL;
         parent->children[i]         = NULL;
     }
 
     parent->childrenCount = 0;
     parent->rebound       = true;
+    cguiTreeVersion++;
 
     // Optimization: Preserve capacity as-is
     return true;
@@ -840,14 +2206,36 @@ bool CguiDeleteAllChildren(CguiNode *parent)
         return true;
     }
 
-    for (int i = parent->childrenCount - 1; i >= 0; i--)
+    // Delete all children subtrees in one sweep, nothing is modified until all roots are pushed
+    int base = cguiTraversalStackCount;
+    for (int i = 0; i < parent->childrenCount; i++)
+    {
+        if (!CguiPushTraversal(parent->children[i], 0, false))
+        {
+            cguiTraversalStackCount = base;
+            return false;
+        }
+    }
+
+    CguiNodeIndex *index = CguiFindIndexOf(parent);
+    if (index)
+    {
+        for (int i = 0; i < parent->childrenCount; i++)
+        {
+            CguiIndexSubtree(index, parent->children[i], false);
+        }
+    }
+
+    for (int i = 0; i < parent->childrenCount; i++)
     {
         parent->children[i]->parent = NULL; // Optimization: reduce unnecessary searching for child in current and unnecessary reallocations when deleting
-        CguiDeleteNode(parent->children[i]);
     }
 
+    CguiDeleteSubtrees(base);
+
     parent->childrenCount = 0;
     parent->rebound       = true;
+    cguiTreeVersion++;
 
     // Optimization: Preserve capacity as-is
     return true;
@@ -929,35 +2317,33 @@ bool CguiTransferChild(CguiNode *fromParent, CguiNode *child, CguiNode *toParent
         return false;
     }
 
-    if (!CguiInsertChild(toParent, child))
-    {
-        return false;
-    }
-
-    if (!CguiRemoveChild(fromParent, child))
+    int childIndex = CguiFindChildIndex(fromParent, child);
+    if (childIndex == -1)
     {
-        CguiRemoveChild(toParent, child);
         return false;
     }
 
-    return true;
+    return CguiTransferChildAt(fromParent, childIndex, toParent);
 }
 
 bool CguiTransferChildAt(CguiNode *fromParent, int childIndex, CguiNode *toParent)
 {
-    if (!fromParent || childIndex < 0 || childIndex >= fromParent->childrenCount || !toParent)
+    if (!fromParent || childIndex < 0 || childIndex >= fromParent->childrenCount || !toParent || fromParent == toParent)
     {
         return false;
     }
 
-    if (!CguiInsertChild(toParent, fromParent->children[childIndex]))
+    CguiNode *child = fromParent->children[childIndex];
+
+    // Remove first so the child is never referenced by two parents
+    if (!CguiRemoveChildAt(fromParent, childIndex))
     {
         return false;
     }
 
-    if (!CguiRemoveChildAt(fromParent, childIndex))
+    if (!CguiInsertChild(toParent, child))
     {
-        CguiRemoveChild(toParent, fromParent->children[childIndex]);
+        CguiInsertChildAt(fromParent, child, childIndex);
         return false;
     }
 
@@ -1299,12 +2685,7 @@ CguiTransformation CguiTFillParent(void)
 
 bool CguiIsTransformationEqual(CguiTransformation a, CguiTransformation b)
 {
-    return (a.position.x == b.position.x && a.position.y == b.position.y) &&
-           (a.size.x == b.size.x && a.size.y == b.size.y) &&
-           (a.isRelativePosition.x == b.isRelativePosition.x && a.isRelativePosition.y == b.isRelativePosition.y) &&
-           (a.isRelativeSize.x == b.isRelativeSize.x && a.isRelativeSize.y == b.isRelativeSize.y) &&
-           (a.anchor.x == b.anchor.x && a.anchor.y == b.anchor.y) &&
-           (a.shrink.x == b.shrink.x && a.shrink.y == b.shrink.y);
+    return CguiIsTransformationEqualP(&a, &b);
 }
 
 void CguiSetTransformation(CguiNode *node, CguiTransformation t)
@@ -1374,6 +2755,12 @@ bool CguiIsTreeTypeEqual(CguiNode *a, CguiNode *b)
     return true;
 }
 
+// Whether the fields kept in compiled tree records differ between the nodes
+static bool CguiIsCompiledStateChanged(const CguiNode *a, const CguiNode *b)
+{
+    return a->enabled != b->enabled || a->clipChildren != b->clipChildren || a->transform != b->transform || a->drawPre != b->drawPre || a->drawPost != b->drawPost;
+}
+
 bool CguiCopyNodeValues(CguiNode *fromNode, CguiNode *toNode)
 {
     if (!fromNode || !toNode)
@@ -1384,10 +2771,29 @@ bool CguiCopyNodeValues(CguiNode *fromNode, CguiNode *toNode)
     CguiNode copyNode = *fromNode;
 
     // Exclude hierarchy from copy
+    copyNode.deleteQueued     = toNode->deleteQueued;
+    copyNode.handleSlot       = toNode->handleSlot;
     copyNode.parent           = toNode->parent;
     copyNode.children         = toNode->children;
     copyNode.childrenCount    = toNode->childrenCount;
     copyNode.childrenCapacity = toNode->childrenCapacity;
+    copyNode.childIndex       = toNode->childIndex;
+    copyNode.index            = toNode->index;
+    copyNode.prevOfType       = NULL;
+    copyNode.nextOfType       = NULL;
+
+    // Template links are not shared, the copy is linked to the same template instead
+    copyNode.templateSource    = toNode->templateSource;
+    copyNode.instances         = toNode->instances;
+    copyNode.instancesCount    = toNode->instancesCount;
+    copyNode.instancesCapacity = toNode->instancesCapacity;
+    copyNode.instanceIndex     = toNode->instanceIndex;
+
+    // Queued node stays disabled until it is deleted
+    if (toNode->deleteQueued)
+    {
+        copyNode.enabled = toNode->enabled;
+    }
 
     if (fromNode->name)
     {
@@ -1401,6 +2807,10 @@ bool CguiCopyNodeValues(CguiNode *fromNode, CguiNode *toNode)
         strcpy(copyNode.name, newName);
     }
 
+    // Empty data (allocated with zero size) is not shared either
+    copyNode.data     = NULL;
+    copyNode.dataSize = 0;
+
     if (fromNode->data && fromNode->dataSize > 0)
     {
         copyNode.data = CG_MALLOC_NULL(fromNode->dataSize);
@@ -1414,8 +2824,8 @@ bool CguiCopyNodeValues(CguiNode *fromNode, CguiNode *toNode)
         copyNode.dataSize = fromNode->dataSize;
     }
 
-    CG_FREE_NULL(toNode->data);
-    toNode->dataSize = 0;
+    copyNode.instanceData     = NULL;
+    copyNode.instanceDataSize = 0;
 
     if (fromNode->instanceData && fromNode->instanceDataSize > 0)
     {
@@ -1431,11 +2841,59 @@ bool CguiCopyNodeValues(CguiNode *fromNode, CguiNode *toNode)
         copyNode.instanceDataSize = fromNode->instanceDataSize;
     }
 
+    // Resources owned by the data (e.g., transition chains) are not shared with the copy
+    if (copyNode.copyNodeData && !copyNode.copyNodeData(fromNode, &copyNode))
+    {
+        CG_FREE_NULL(copyNode.name);
+        CG_FREE_NULL(copyNode.data);
+        CG_FREE_NULL(copyNode.instanceData);
+        return false;
+    }
+
+    // Overwritten data releases its resources
+    if (toNode->deleteNodeData)
+    {
+        toNode->deleteNodeData(toNode);
+    }
+
+    CG_FREE_NULL(toNode->data);
+    toNode->dataSize = 0;
+
     CG_FREE_NULL(toNode->instanceData);
     toNode->instanceDataSize = 0;
 
+    // Re-index with the new name and type
+    CguiNodeIndex *index = CguiFindIndexOf(toNode);
+    if (index)
+    {
+        CguiUnindexNode(index, toNode);
+    }
+
+    CG_FREE_NULL(toNode->name);
+
+    // Optimization: Compiled trees are only rebuilt if their records change
+    if (CguiIsCompiledStateChanged(toNode, &copyNode))
+    {
+        cguiTreeVersion++;
+    }
+
     *toNode = copyNode;
 
+    if (index)
+    {
+        CguiIndexNode(index, toNode);
+    }
+
+    if (toNode->templateSource != fromNode->templateSource)
+    {
+        CguiUnlinkTemplate(toNode);
+
+        if (fromNode->templateSource && !CguiLinkTemplate(toNode, fromNode->templateSource))
+        {
+            CG_LOG_ERROR("Failed to link the copy of \"%s\" to its template", toNode->name);
+        }
+    }
+
     return true;
 }
 
@@ -1449,19 +2907,32 @@ bool CguiCopyNodeValuesNoTi(CguiNode *fromNode, CguiNode *toNode)
     CguiNode copyNode = *fromNode;
 
     // Exclude hierarchy and instance data from copy
+    copyNode.deleteQueued      = toNode->deleteQueued;
+    copyNode.handleSlot        = toNode->handleSlot;
     copyNode.parent            = toNode->parent;
     copyNode.children          = toNode->children;
     copyNode.childrenCount     = toNode->childrenCount;
     copyNode.childrenCapacity  = toNode->childrenCapacity;
+    copyNode.childIndex        = toNode->childIndex;
+    copyNode.index             = toNode->index;
+    copyNode.prevOfType        = NULL;
+    copyNode.nextOfType        = NULL;
     copyNode.templateSource    = toNode->templateSource;
     copyNode.instances         = toNode->instances;
     copyNode.instancesCount    = toNode->instancesCount;
     copyNode.instancesCapacity = toNode->instancesCapacity;
+    copyNode.instanceIndex     = toNode->instanceIndex;
     copyNode.resync            = toNode->resync;
     copyNode.instanceData      = toNode->instanceData;
     copyNode.instanceDataSize  = toNode->instanceDataSize;
     copyNode.override          = toNode->override;
 
+    // Queued node stays disabled until it is deleted
+    if (toNode->deleteQueued)
+    {
+        copyNode.enabled = toNode->enabled;
+    }
+
     if (fromNode->name)
     {
         const char *newName = TextFormat("%s (Copied #%d)", fromNode->name, ++cguiNameCounter);
@@ -1474,6 +2945,10 @@ bool CguiCopyNodeValuesNoTi(CguiNode *fromNode, CguiNode *toNode)
         strcpy(copyNode.name, newName);
     }
 
+    // Empty data (allocated with zero size) is not shared either
+    copyNode.data     = NULL;
+    copyNode.dataSize = 0;
+
     if (fromNode->data && fromNode->dataSize > 0)
     {
         copyNode.data = CG_MALLOC_NULL(fromNode->dataSize);
@@ -1490,8 +2965,28 @@ bool CguiCopyNodeValuesNoTi(CguiNode *fromNode, CguiNode *toNode)
     CG_FREE_NULL(toNode->data);
     toNode->dataSize = 0;
 
+    // Re-index with the new name and type
+    CguiNodeIndex *index = CguiFindIndexOf(toNode);
+    if (index)
+    {
+        CguiUnindexNode(index, toNode);
+    }
+
+    CG_FREE_NULL(toNode->name);
+
+    // Optimization: Compiled trees are only rebuilt if their records change
+    if (CguiIsCompiledStateChanged(toNode, &copyNode))
+    {
+        cguiTreeVersion++;
+    }
+
     *toNode = copyNode;
 
+    if (index)
+    {
+        CguiIndexNode(index, toNode);
+    }
+
     return true;
 }
 
@@ -1572,6 +3067,20 @@ int CguiFindChildIndex(CguiNode *parent, CguiNode *child)
         return -1;
     }
 
+    // Optimization: Use the back-index of the attached child
+    if (child->parent == parent &&
+        child->childIndex >= 0 && child->childIndex < parent->childrenCount &&
+        parent->children[child->childIndex] == child)
+    {
+        return child->childIndex;
+    }
+
+    // Optimization: Detached node cannot be a child
+    if (!child->parent)
+    {
+        return -1;
+    }
+
     for (int i = 0; i < parent->childrenCount; i++)
     {
         if (parent->children[i] == child)
@@ -1595,14 +3104,12 @@ bool CguiIsAncestorOf(CguiNode *child, CguiNode *parent)
         return false;
     }
 
-    if (child->parent == parent)
-    {
-        return true;
-    }
-
-    if (child->parent)
+    for (CguiNode *current = child->parent; current; current = current->parent)
     {
-        return CguiIsAncestorOf(child->parent, parent);
+        if (current == parent)
+        {
+            return true;
+        }
     }
 
     return false;
@@ -1660,10 +3167,12 @@ Rectangle CguiComputeNodeBounds(CguiNode *node)
         return CguiRecZero();
     }
 
-    Rectangle bounds  = CguiRecZero();
-    Rectangle pBounds = node->parent ? node->parent->bounds : CguiGetAppSizeRec();
+    return CguiComputeBounds(node->transformation, node->parent ? node->parent->bounds : CguiGetAppSizeRec());
+}
 
-    CguiTransformation t = node->transformation;
+Rectangle CguiComputeBounds(CguiTransformation t, Rectangle pBounds)
+{
+    Rectangle bounds = CguiRecZero();
 
     bounds.width  = (t.size.x * (pBounds.width - t.shrink.x)) * t.isRelativeSize.x + t.size.x * (1.0f - t.isRelativeSize.x);
     bounds.height = (t.size.y * (pBounds.height - t.shrink.y)) * t.isRelativeSize.y + t.size.y * (1.0f - t.isRelativeSize.y);
@@ -1674,6 +3183,92 @@ Rectangle CguiComputeNodeBounds(CguiNode *node)
     return bounds;
 }
 
+void CguiComputeBoundsAxisBatch(const float *position, const float *size, const float *isRelativePosition, const float *isRelativeSize, const float *anchor, const float *shrink, const float *pPosition, const float *pSize, float *outPosition, float *outSize, int count)
+{
+    int i = 0;
+
+    // Same formula as CguiComputeBounds, per axis:
+    // size     = (size * (pSize - shrink)) * isRelativeSize + size * (1 - isRelativeSize)
+    // position = (pPosition + pSize * anchor - size * anchor + position) * isRelativePosition + position * (1 - isRelativePosition)
+
+#ifdef CGUI_SIMD_AVX
+    const __m256 one8 = _mm256_set1_ps(1.0f);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 p  = _mm256_loadu_ps(&position[i]);
+        __m256 s  = _mm256_loadu_ps(&size[i]);
+        __m256 rp = _mm256_loadu_ps(&isRelativePosition[i]);
+        __m256 rs = _mm256_loadu_ps(&isRelativeSize[i]);
+        __m256 a  = _mm256_loadu_ps(&anchor[i]);
+        __m256 sh = _mm256_loadu_ps(&shrink[i]);
+        __m256 pp = _mm256_loadu_ps(&pPosition[i]);
+        __m256 ps = _mm256_loadu_ps(&pSize[i]);
+
+        __m256 os = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(s, _mm256_sub_ps(ps, sh)), rs), _mm256_mul_ps(s, _mm256_sub_ps(one8, rs)));
+        __m256 op = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_add_ps(pp, _mm256_mul_ps(ps, a)), _mm256_mul_ps(os, a)), p), rp), _mm256_mul_ps(p, _mm256_sub_ps(one8, rp)));
+
+        _mm256_storeu_ps(&outSize[i], os);
+        _mm256_storeu_ps(&outPosition[i], op);
+    }
+#endif
+
+#ifdef CGUI_SIMD_SSE
+    const __m128 one4 = _mm_set1_ps(1.0f);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 p  = _mm_loadu_ps(&position[i]);
+        __m128 s  = _mm_loadu_ps(&size[i]);
+        __m128 rp = _mm_loadu_ps(&isRelativePosition[i]);
+        __m128 rs = _mm_loadu_ps(&isRelativeSize[i]);
+        __m128 a  = _mm_loadu_ps(&anchor[i]);
+        __m128 sh = _mm_loadu_ps(&shrink[i]);
+        __m128 pp = _mm_loadu_ps(&pPosition[i]);
+        __m128 ps = _mm_loadu_ps(&pSize[i]);
+
+        __m128 os = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, _mm_sub_ps(ps, sh)), rs), _mm_mul_ps(s, _mm_sub_ps(one4, rs)));
+        __m128 op = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_add_ps(pp, _mm_mul_ps(ps, a)), _mm_mul_ps(os, a)), p), rp), _mm_mul_ps(p, _mm_sub_ps(one4, rp)));
+
+        _mm_storeu_ps(&outSize[i], os);
+        _mm_storeu_ps(&outPosition[i], op);
+    }
+#endif
+
+#ifdef CGUI_SIMD_NEON
+    const float32x4_t one4 = vdupq_n_f32(1.0f);
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t p  = vld1q_f32(&position[i]);
+        float32x4_t s  = vld1q_f32(&size[i]);
+        float32x4_t rp = vld1q_f32(&isRelativePosition[i]);
+        float32x4_t rs = vld1q_f32(&isRelativeSize[i]);
+        float32x4_t a  = vld1q_f32(&anchor[i]);
+        float32x4_t sh = vld1q_f32(&shrink[i]);
+        float32x4_t pp = vld1q_f32(&pPosition[i]);
+        float32x4_t ps = vld1q_f32(&pSize[i]);
+
+        // Note: vfmaq is avoided, fused multiply-add rounds differently from the scalar tail
+        float32x4_t os = vaddq_f32(vmulq_f32(vmulq_f32(s, vsubq_f32(ps, sh)), rs), vmulq_f32(s, vsubq_f32(one4, rs)));
+        float32x4_t op = vaddq_f32(vmulq_f32(vaddq_f32(vsubq_f32(vaddq_f32(pp, vmulq_f32(ps, a)), vmulq_f32(os, a)), p), rp), vmulq_f32(p, vsubq_f32(one4, rp)));
+
+        vst1q_f32(&outSize[i], os);
+        vst1q_f32(&outPosition[i], op);
+    }
+#endif
+
+    // Remaining (or all, without SIMD)
+    for (; i < count; i++)
+    {
+        outSize[i]     = (size[i] * (pSize[i] - shrink[i])) * isRelativeSize[i] + size[i] * (1.0f - isRelativeSize[i]);
+        outPosition[i] = (pPosition[i] + pSize[i] * anchor[i] - outSize[i] * anchor[i] + position[i]) * isRelativePosition[i] + position[i] * (1.0f - isRelativePosition[i]);
+    }
+}
+
+// Whether children of the node may collide with the point
+static bool CguiIsChildrenCollidable(CguiNode *node, Vector2 point)
+{
+    return !node->clipChildren || CheckCollisionPointRec(point, node->bounds);
+}
+
 CguiNode *CguiCheckCollision(CguiNode *node, Vector2 point)
 {
     if (!node)
@@ -1681,20 +3276,46 @@ CguiNode *CguiCheckCollision(CguiNode *node, Vector2 point)
         return NULL;
     }
 
+    int base = cguiTraversalStackCount;
+
+    // Disabled nodes are not collided, including their children
+    if (!node->enabled)
+    {
+        return NULL;
+    }
+
     // Check the deepest collision first
     // Reverse iteration to check overlaps first (top-drawn is later children)
-    for (int i = node->childrenCount - 1; i >= 0; i--)
+    // Optimization: Children of a clipping node are not checked outside its bounds
+    if (!CguiPushTraversal(node, CguiIsChildrenCollidable(node, point) ? node->childrenCount - 1 : -1, false))
     {
-        CguiNode *collided = CguiCheckCollision(node->children[i], point);
-        if (collided)
-        {
-            return collided;
-        }
+        return NULL;
     }
 
-    if (CheckCollisionPointRec(point, node->bounds))
+    while (cguiTraversalStackCount > base)
     {
-        return node;
+        CguiTraversalEntry *top = &cguiTraversalStack[cguiTraversalStackCount - 1];
+
+        if (top->index >= 0)
+        {
+            CguiNode *child = top->node->children[top->index--];
+            if (child && child->enabled && !CguiPushTraversal(child, CguiIsChildrenCollidable(child, point) ? child->childrenCount - 1 : -1, false))
+            {
+                cguiTraversalStackCount = base;
+                return NULL;
+            }
+
+            continue;
+        }
+
+        CguiNode *done = top->node;
+        cguiTraversalStackCount--;
+
+        if (CheckCollisionPointRec(point, done->bounds))
+        {
+            cguiTraversalStackCount = base;
+            return done;
+        }
     }
 
     return NULL;
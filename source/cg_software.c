@@ -0,0 +1,519 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This source file contains implementations for software rendering.
+///
+/// This project is licensed under the terms of MIT license.
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "crystalgui/crystalgui.h"
+#include "raylib.h"
+#include "raymath.h"
+
+// SIMD instruction sets for box signed distances (define CG_NO_SIMD to use scalar only)
+// Note: Results match the scalar fallback, the file is built without fused multiply-add
+#ifndef CG_NO_SIMD
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define CGUI_SIMD_SSE
+#endif
+// Note: Vector square root is only available on AArch64
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CGUI_SIMD_NEON
+#endif
+#endif // CG_NO_SIMD
+
+// Number of pixels in a row to compute box signed distances at once
+#ifndef CGUI_SOFTWARE_BOX_CHUNK
+#define CGUI_SOFTWARE_BOX_CHUNK 64
+#endif
+
+// Registered pixels of a texture
+struct CguiSoftwareTexture {
+    unsigned int id;    // Texture id
+    Image        image; // Pixels of the texture
+};
+
+typedef struct CguiSoftwareTexture CguiSoftwareTexture;
+
+// Pixels to rasterize
+typedef struct CguiSoftwareSpan {
+    int x0; // First column
+    int y0; // First row
+    int x1; // Column after the last
+    int y1; // Row after the last
+} CguiSoftwareSpan;
+
+CguiSoftwareRenderer *CguiCreateSoftwareRenderer(int width, int height)
+{
+    if (width <= 0 || height <= 0)
+    {
+        return NULL;
+    }
+
+    CguiSoftwareRenderer *renderer = CG_MALLOC_NULL(sizeof(CguiSoftwareRenderer));
+    if (!renderer)
+    {
+        return NULL;
+    }
+
+    renderer->image = GenImageColor(width, height, BLANK);
+    renderer->list  = CguiCreateDrawList();
+    if (!renderer->image.data || !renderer->list)
+    {
+        CG_LOG_ERROR("Failed to create software renderer of size %dx%d", width, height);
+        CguiDeleteSoftwareRenderer(renderer);
+        return NULL;
+    }
+
+    return renderer;
+}
+
+void CguiDeleteSoftwareRenderer(CguiSoftwareRenderer *renderer)
+{
+    if (!renderer)
+    {
+        return;
+    }
+
+    if (renderer->image.data) UnloadImage(renderer->image);
+
+    CguiDeleteDrawList(renderer->list);
+    CG_FREE_NULL(renderer->textures);
+    CG_FREE_NULL(renderer);
+}
+
+bool CguiSetSoftwareTexture(CguiSoftwareRenderer *renderer, Texture texture, Image image)
+{
+    if (!renderer || texture.id == 0 || !image.data || image.width <= 0 || image.height <= 0)
+    {
+        return false;
+    }
+
+    // Replace already registered image
+    for (int i = 0; i < renderer->texturesCount; i++)
+    {
+        if (renderer->textures[i].id == texture.id)
+        {
+            renderer->textures[i].image = image;
+            return true;
+        }
+    }
+
+    // Resize capacity if full
+    if (renderer->texturesCount == renderer->texturesCapacity)
+    {
+        int                  newCapacity = (renderer->texturesCapacity == 0) ? 8 : (renderer->texturesCapacity * 2);
+        CguiSoftwareTexture *newTextures = CG_REALLOC(renderer->textures, sizeof(CguiSoftwareTexture) * newCapacity);
+        if (!newTextures)
+        {
+            return false;
+        }
+
+        renderer->textures         = newTextures;
+        renderer->texturesCapacity = newCapacity;
+    }
+
+    renderer->textures[renderer->texturesCount++] = (CguiSoftwareTexture) { .id = texture.id, .image = image };
+
+    return true;
+}
+
+void CguiClearSoftwareRenderer(CguiSoftwareRenderer *renderer, Color color)
+{
+    if (!renderer)
+    {
+        return;
+    }
+
+    Color *pixels = renderer->image.data;
+    int    count  = renderer->image.width * renderer->image.height;
+
+    for (int i = 0; i < count; i++)
+    {
+        pixels[i] = color;
+    }
+}
+
+// Get the registered image of the texture, NULL if not registered
+static const Image *CguiGetSoftwareTexture(const CguiSoftwareRenderer *renderer, unsigned int id)
+{
+    if (id == 0)
+    {
+        return NULL;
+    }
+
+    for (int i = 0; i < renderer->texturesCount; i++)
+    {
+        if (renderer->textures[i].id == id)
+        {
+            return &renderer->textures[i].image;
+        }
+    }
+
+    return NULL;
+}
+
+// Get the normalized color of the texel (clamped to the edges)
+static Vector4 CguiGetSoftwareTexel(const Image *image, float x, float y)
+{
+    int tx = (int) Clamp(floorf(x), 0.0f, (float) (image->width - 1));
+    int ty = (int) Clamp(floorf(y), 0.0f, (float) (image->height - 1));
+
+    // Optimization: Read pixels directly in the rendered format
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        return ColorNormalize(((const Color *) image->data)[ty * image->width + tx]);
+    }
+
+    return ColorNormalize(GetImageColor(*image, tx, ty));
+}
+
+// Blend the normalized color over the pixel (same as raylib's default blend mode)
+static void CguiBlendSoftwarePixel(Color *pixel, Vector4 color)
+{
+    if (color.w <= 0.0f)
+    {
+        return;
+    }
+
+    Vector4 dst = ColorNormalize(*pixel);
+    float   inv = 1.0f - color.w;
+
+    pixel->r = (unsigned char) (Clamp(color.x * color.w + dst.x * inv, 0.0f, 1.0f) * 255.0f + 0.5f);
+    pixel->g = (unsigned char) (Clamp(color.y * color.w + dst.y * inv, 0.0f, 1.0f) * 255.0f + 0.5f);
+    pixel->b = (unsigned char) (Clamp(color.z * color.w + dst.z * inv, 0.0f, 1.0f) * 255.0f + 0.5f);
+    pixel->a = (unsigned char) (Clamp(color.w * color.w + dst.w * inv, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+// Get the pixels whose centers are inside the area, limited to the clip, returns true if any
+static bool CguiGetSoftwareSpan(Rectangle area, CguiSoftwareSpan clip, CguiSoftwareSpan *span)
+{
+    span->x0 = (int) Clamp(ceilf(area.x - 0.5f), (float) clip.x0, (float) clip.x1);
+    span->y0 = (int) Clamp(ceilf(area.y - 0.5f), (float) clip.y0, (float) clip.y1);
+    span->x1 = (int) Clamp(ceilf(area.x + area.width - 0.5f), (float) clip.x0, (float) clip.x1);
+    span->y1 = (int) Clamp(ceilf(area.y + area.height - 0.5f), (float) clip.y0, (float) clip.y1);
+
+    return span->x0 < span->x1 && span->y0 < span->y1;
+}
+
+static void CguiRenderSoftwareRectangle(CguiSoftwareRenderer *renderer, const CguiDrawCommand *command, CguiSoftwareSpan clip)
+{
+    CguiSoftwareSpan span;
+    if (!CguiGetSoftwareSpan(command->dest, clip, &span))
+    {
+        return;
+    }
+
+    Color  *pixels = renderer->image.data;
+    Vector4 color  = ColorNormalize(command->data.rectangle.color);
+
+    for (int y = span.y0; y < span.y1; y++)
+    {
+        for (int x = span.x0; x < span.x1; x++)
+        {
+            CguiBlendSoftwarePixel(&pixels[y * renderer->image.width + x], color);
+        }
+    }
+}
+
+static void CguiRenderSoftwareTexture(CguiSoftwareRenderer *renderer, const CguiDrawCommand *command, CguiSoftwareSpan clip)
+{
+    const Image *image = CguiGetSoftwareTexture(renderer, command->data.texture.texture.id);
+    if (!image || command->dest.width == 0.0f || command->dest.height == 0.0f)
+    {
+        return;
+    }
+
+    CguiSoftwareSpan span;
+    if (!CguiGetSoftwareSpan(command->bounds, clip, &span))
+    {
+        return;
+    }
+
+    // Negative source size flips the texture (same as DrawTexturePro())
+    Rectangle source = command->data.texture.source;
+    bool      flipX  = source.width < 0.0f;
+    bool      flipY  = source.height < 0.0f;
+    source.width     = fabsf(source.width);
+    source.height    = fabsf(source.height);
+
+    // Pixels are mapped back to the quad, rotated along the destination position
+    Color  *pixels = renderer->image.data;
+    Vector4 tint   = ColorNormalize(command->data.texture.tint);
+    float   cosA   = cosf(-command->data.texture.rotation * DEG2RAD);
+    float   sinA   = sinf(-command->data.texture.rotation * DEG2RAD);
+
+    for (int y = span.y0; y < span.y1; y++)
+    {
+        for (int x = span.x0; x < span.x1; x++)
+        {
+            float px = x + 0.5f - command->dest.x;
+            float py = y + 0.5f - command->dest.y;
+            float u  = (px * cosA - py * sinA + command->data.texture.origin.x) / command->dest.width;
+            float v  = (px * sinA + py * cosA + command->data.texture.origin.y) / command->dest.height;
+
+            if (u < 0.0f || u >= 1.0f || v < 0.0f || v >= 1.0f)
+            {
+                continue;
+            }
+
+            if (flipX) u = 1.0f - u;
+            if (flipY) v = 1.0f - v;
+
+            Vector4 texel = CguiGetSoftwareTexel(image, source.x + u * source.width, source.y + v * source.height);
+            Vector4 color = { texel.x * tint.x, texel.y * tint.y, texel.z * tint.z, texel.w * tint.w };
+
+            CguiBlendSoftwarePixel(&pixels[y * renderer->image.width + x], color);
+        }
+    }
+}
+
+// Get the corner radius used by the box signed distance (same as BoxSDF in box.fs)
+static float CguiGetBoxSDFRadius(Vector2 halfSize, Vector4 radii)
+{
+    // Scale overlapping radii down proportionally
+    float maxTop    = radii.x + radii.y;
+    float maxBottom = radii.z + radii.w;
+    float maxLeft   = radii.x + radii.z;
+    float maxRight  = radii.y + radii.w;
+
+    float scaleTop    = (maxTop > 2.0f * halfSize.x) ? (2.0f * halfSize.x) / maxTop : 1.0f;
+    float scaleBottom = (maxBottom > 2.0f * halfSize.x) ? (2.0f * halfSize.x) / maxBottom : 1.0f;
+    float scaleLeft   = (maxLeft > 2.0f * halfSize.y) ? (2.0f * halfSize.y) / maxLeft : 1.0f;
+    float scaleRight  = (maxRight > 2.0f * halfSize.y) ? (2.0f * halfSize.y) / maxRight : 1.0f;
+
+    // Note: The shader only uses the top-left radius for the distance
+    return radii.x * fminf(fminf(scaleTop, scaleBottom), fminf(scaleLeft, scaleRight));
+}
+
+// Compute the signed distances of the pixel centers in a row to a rounded box
+static void CguiComputeBoxSDFRow(int x, int y, int count, Vector2 center, Vector2 halfSize, float radius, float *out)
+{
+    int i = 0;
+
+    // Same formula as BoxSDF in box.fs, per pixel:
+    // dist     = abs(pixel - center) - halfSize + radius
+    // distance = min(max(dist.x, dist.y), 0) + length(max(dist, 0)) - radius
+
+    float distY    = fabsf(y + 0.5f - center.y) - halfSize.y + radius;
+    float outsideY = fmaxf(distY, 0.0f) * fmaxf(distY, 0.0f);
+    float startX   = x + 0.5f - center.x;
+
+#ifdef CGUI_SIMD_SSE
+    const __m128 sign4     = _mm_set1_ps(-0.0f);
+    const __m128 zero4     = _mm_setzero_ps();
+    const __m128 lanes4    = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+    const __m128 offset4   = _mm_set1_ps(radius - halfSize.x);
+    const __m128 radius4   = _mm_set1_ps(radius);
+    const __m128 distY4    = _mm_set1_ps(distY);
+    const __m128 outsideY4 = _mm_set1_ps(outsideY);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 px      = _mm_add_ps(_mm_set1_ps(startX), _mm_add_ps(_mm_set1_ps((float) i), lanes4));
+        __m128 distX   = _mm_add_ps(_mm_andnot_ps(sign4, px), offset4);
+        __m128 inside  = _mm_min_ps(_mm_max_ps(distX, distY4), zero4);
+        __m128 outX    = _mm_max_ps(distX, zero4);
+        __m128 outside = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(outX, outX), outsideY4));
+
+        _mm_storeu_ps(&out[i], _mm_sub_ps(_mm_add_ps(inside, outside), radius4));
+    }
+#endif
+
+#ifdef CGUI_SIMD_NEON
+    const float32x4_t zero4     = vdupq_n_f32(0.0f);
+    const float32x4_t lanes4    = { 0.0f, 1.0f, 2.0f, 3.0f };
+    const float32x4_t offset4   = vdupq_n_f32(radius - halfSize.x);
+    const float32x4_t radius4   = vdupq_n_f32(radius);
+    const float32x4_t distY4    = vdupq_n_f32(distY);
+    const float32x4_t outsideY4 = vdupq_n_f32(outsideY);
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t px      = vaddq_f32(vdupq_n_f32(startX), vaddq_f32(vdupq_n_f32((float) i), lanes4));
+        float32x4_t distX   = vaddq_f32(vabsq_f32(px), offset4);
+        float32x4_t inside  = vminq_f32(vmaxq_f32(distX, distY4), zero4);
+        float32x4_t outX    = vmaxq_f32(distX, zero4);
+        float32x4_t outside = vsqrtq_f32(vaddq_f32(vmulq_f32(outX, outX), outsideY4));
+
+        vst1q_f32(&out[i], vsubq_f32(vaddq_f32(inside, outside), radius4));
+    }
+#endif
+
+    // Remaining (or all, without SIMD)
+    for (; i < count; i++)
+    {
+        float distX = fabsf(startX + i) + (radius - halfSize.x);
+        float outX  = fmaxf(distX, 0.0f);
+        out[i]      = fminf(fmaxf(distX, distY), 0.0f) + sqrtf(outX * outX + outsideY) - radius;
+    }
+}
+
+// Same as GLSL smoothstep()
+static float CguiSmoothStep(float edge0, float edge1, float x)
+{
+    float t = Clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+    return t * t * (3.0f - 2.0f * t);
+}
+
+// Blend normalized colors (same as AlphaBlendOver in box.fs)
+static Vector4 CguiAlphaBlendOver(Vector4 top, Vector4 bottom)
+{
+    Vector4 result = { 0 };
+    result.w       = top.w + bottom.w * (1.0f - top.w);
+
+    if (result.w > 0.0f)
+    {
+        result.x = (top.x * top.w + bottom.x * bottom.w * (1.0f - top.w)) / result.w;
+        result.y = (top.y * top.w + bottom.y * bottom.w * (1.0f - top.w)) / result.w;
+        result.z = (top.z * top.w + bottom.z * bottom.w * (1.0f - top.w)) / result.w;
+    }
+
+    return result;
+}
+
+// Multiply the color by the texel of the box texture (stretched over the image)
+static Vector4 CguiTintSoftwareBoxTexel(const CguiSoftwareRenderer *renderer, const Image *texture, int x, int y, Vector4 color)
+{
+    if (!texture)
+    {
+        return color;
+    }
+
+    float   u     = (x + 0.5f) / renderer->image.width;
+    float   v     = (y + 0.5f) / renderer->image.height;
+    Vector4 texel = CguiGetSoftwareTexel(texture, u * texture->width, v * texture->height);
+
+    return (Vector4) { texel.x * color.x, texel.y * color.y, texel.z * color.z, texel.w * color.w };
+}
+
+static void CguiRenderSoftwareBox(CguiSoftwareRenderer *renderer, const CguiDrawCommand *command, CguiSoftwareSpan clip)
+{
+    const CguiBoxElementData *data = &command->data.box;
+
+    // Bounds include the anti-aliased edges
+    CguiSoftwareSpan span;
+    if (!CguiGetSoftwareSpan(command->bounds, clip, &span))
+    {
+        return;
+    }
+
+    Vector2 halfSize       = { command->dest.width * 0.5f, command->dest.height * 0.5f };
+    Vector2 center         = { command->dest.x + halfSize.x, command->dest.y + halfSize.y };
+    Vector2 shadowHalfSize = { halfSize.x - data->shadowShrink, halfSize.y - data->shadowShrink };
+    Vector2 shadowCenter   = Vector2Add(center, data->shadowOffset);
+    float   radius         = CguiGetBoxSDFRadius(halfSize, data->radii);
+    float   shadowRadius   = CguiGetBoxSDFRadius(shadowHalfSize, data->radii);
+
+    Vector4 color       = ColorNormalize(data->color);
+    Vector4 shadowColor = ColorNormalize(data->shadowColor);
+    Vector4 borderColor = ColorNormalize(data->borderColor);
+
+    // Unregistered textures are not multiplied
+    const Image *texture       = CguiGetSoftwareTexture(renderer, data->texture.id);
+    const Image *shadowTexture = CguiGetSoftwareTexture(renderer, data->shadowTexture.id);
+    const Image *borderTexture = CguiGetSoftwareTexture(renderer, data->borderTexture.id);
+
+    Color *pixels = renderer->image.data;
+    float  recSDF[CGUI_SOFTWARE_BOX_CHUNK];
+    float  shadowSDF[CGUI_SOFTWARE_BOX_CHUNK];
+
+    for (int y = span.y0; y < span.y1; y++)
+    {
+        for (int x = span.x0; x < span.x1; x += CGUI_SOFTWARE_BOX_CHUNK)
+        {
+            int count = (int) fminf(span.x1 - x, CGUI_SOFTWARE_BOX_CHUNK);
+
+            CguiComputeBoxSDFRow(x, y, count, center, halfSize, radius, recSDF);
+            CguiComputeBoxSDFRow(x, y, count, shadowCenter, shadowHalfSize, shadowRadius, shadowSDF);
+
+            for (int i = 0; i < count; i++)
+            {
+                // Note: Zero shadow distance is undefined in the shader, no shadow is drawn
+                float recFactor    = CguiSmoothStep(1.0f, 0.0f, recSDF[i]);
+                float shadowFactor = data->shadowDistance > 0.0f ? CguiSmoothStep(data->shadowDistance, 0.0f, shadowSDF[i]) : 0.0f;
+                float borderFactor = CguiSmoothStep(0.0f, 1.0f, recSDF[i] + data->borderThickness) * recFactor;
+
+                Vector4 factoredColor       = { color.x, color.y, color.z, color.w * Clamp(recFactor, 0.0f, 1.0f) };
+                Vector4 factoredShadowColor = { shadowColor.x, shadowColor.y, shadowColor.z, shadowColor.w * Clamp(shadowFactor, 0.0f, 1.0f) };
+                Vector4 factoredBorderColor = { borderColor.x, borderColor.y, borderColor.z, borderColor.w * Clamp(borderFactor, 0.0f, 1.0f) };
+
+                factoredColor       = CguiTintSoftwareBoxTexel(renderer, texture, x + i, y, factoredColor);
+                factoredShadowColor = CguiTintSoftwareBoxTexel(renderer, shadowTexture, x + i, y, factoredShadowColor);
+                factoredBorderColor = CguiTintSoftwareBoxTexel(renderer, borderTexture, x + i, y, factoredBorderColor);
+
+                Vector4 combined = CguiAlphaBlendOver(factoredBorderColor, CguiAlphaBlendOver(factoredColor, factoredShadowColor));
+
+                CguiBlendSoftwarePixel(&pixels[y * renderer->image.width + x + i], combined);
+            }
+        }
+    }
+}
+
+void CguiRenderDrawListSoftware(CguiSoftwareRenderer *renderer, CguiDrawList *list)
+{
+    if (!renderer || !list)
+    {
+        return;
+    }
+
+    CguiSoftwareSpan image = { 0, 0, renderer->image.width, renderer->image.height };
+    CguiSoftwareSpan clip  = image;
+
+    for (int i = 0; i < list->commandsCount; i++)
+    {
+        const CguiDrawCommand *command = &list->commands[i];
+
+        switch (command->type)
+        {
+            case CGUI_DRAW_COMMAND_TYPE_RECTANGLE:
+                CguiRenderSoftwareRectangle(renderer, command, clip);
+                break;
+            case CGUI_DRAW_COMMAND_TYPE_TEXTURE:
+                CguiRenderSoftwareTexture(renderer, command, clip);
+                break;
+            case CGUI_DRAW_COMMAND_TYPE_BOX:
+                CguiRenderSoftwareBox(renderer, command, clip);
+                break;
+            case CGUI_DRAW_COMMAND_TYPE_SCISSOR_BEGIN:
+            {
+                // Scissor area is truncated to integers (same as BeginScissorMode())
+                Rectangle area = { (float) (int) command->bounds.x, (float) (int) command->bounds.y, (float) (int) command->bounds.width, (float) (int) command->bounds.height };
+                if (!CguiGetSoftwareSpan(area, image, &clip))
+                {
+                    clip = (CguiSoftwareSpan) { 0 };
+                }
+                break;
+            }
+            case CGUI_DRAW_COMMAND_TYPE_SCISSOR_END:
+                clip = image;
+                break;
+            case CGUI_DRAW_COMMAND_TYPE_CALLBACK:
+                // Skipped, callbacks draw with raylib directly
+                break;
+        }
+    }
+}
+
+void CguiRenderNodeSoftware(CguiSoftwareRenderer *renderer, CguiNode *node)
+{
+    if (!renderer || !node)
+    {
+        return;
+    }
+
+    CguiClearDrawList(renderer->list);
+
+    CguiBeginDrawList(renderer->list);
+    CguiDrawNode(node);
+    CguiEndDrawList();
+
+    CguiRenderDrawListSoftware(renderer, renderer->list);
+    CguiClearDrawList(renderer->list);
+}
@@ -0,0 +1,492 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This source file contains implementations for keyframe timelines.
+///
+/// This project is licensed under the terms of MIT license.
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "crystalgui/crystalgui.h"
+#include "raylib.h"
+
+// Version of the timeline binary format
+#define CGUI_TIMELINE_VERSION 1
+
+// Maximum number of floats in a value of a key
+#define CGUI_TIMELINE_COMPONENTS_MAX 16
+
+struct CguiTimelineHeader;
+typedef struct CguiTimelineHeader CguiTimelineHeader;
+
+// Every field is 4 bytes, so the format has no padding
+struct CguiTimelineHeader {
+    char     magic[4];    // "CGTL"
+    uint32_t version;     // Format version
+    uint32_t tracksCount; // Number of tracks
+    uint32_t keysCount;   // Number of keys of all tracks
+    uint32_t valuesCount; // Number of floats in values of all keys
+    float    duration;    // Time of the last key among all tracks
+};
+
+struct CguiTimelineTrack;
+typedef struct CguiTimelineTrack CguiTimelineTrack;
+
+struct CguiTimelineTrack {
+    uint32_t firstKey;   // Index of the first key of the track
+    uint32_t keysCount;  // Number of keys of the track
+    uint32_t components; // Number of floats in a value
+    uint32_t firstValue; // Index of the first float of the first value
+};
+
+// Size of the data in the binary format
+static uint64_t CguiGetTimelineDataSize(uint64_t tracksCount, uint64_t keysCount, uint64_t valuesCount)
+{
+    return sizeof(CguiTimelineHeader)
+         + sizeof(CguiTimelineTrack) * tracksCount
+         + sizeof(float) * keysCount     // Times
+         + sizeof(uint32_t) * keysCount  // Easing kinds
+         + sizeof(float) * valuesCount;  // Values
+}
+
+// Whether the data of the counts fits in an int size (counts are limited first to prevent overflowing)
+static bool CguiIsTimelineDataSizeValid(uint64_t tracksCount, uint64_t keysCount, uint64_t valuesCount)
+{
+    return tracksCount <= INT32_MAX / sizeof(CguiTimelineTrack) && keysCount <= INT32_MAX / 8 && valuesCount <= INT32_MAX / 4
+        && CguiGetTimelineDataSize(tracksCount, keysCount, valuesCount) <= INT32_MAX;
+}
+
+// The format is little-endian and read in place, so it is only available on little-endian hosts
+static bool CguiIsTimelineByteOrderNative(void)
+{
+    const uint32_t one = 1;
+    if (*(const unsigned char *) &one != 1)
+    {
+        CG_LOG_ERROR("Timelines are little-endian, they are not supported on big-endian hosts");
+        return false;
+    }
+
+    return true;
+}
+
+// Time of the last set key among all tracks
+static float CguiComputeTimelineDuration(const CguiTimeline *timeline)
+{
+    float duration = 0.0f;
+    for (int i = 0; i < timeline->tracksCount; i++)
+    {
+        const CguiTimelineTrack *track = &timeline->tracks[i];
+        const float             *times = timeline->times + track->firstKey;
+
+        // Keys are in order, the last set key has the latest time of the track
+        int last = (int) track->keysCount - 1;
+        while (last >= 0 && isnan(times[last]))
+        {
+            last--;
+        }
+
+        if (last >= 0 && times[last] > duration)
+        {
+            duration = times[last];
+        }
+    }
+
+    return duration;
+}
+
+// Whether all the keys are set, with finite times in order within their tracks (tracks must be validated)
+static bool CguiAreTimelineKeysValid(const CguiTimelineTrack *tracks, uint32_t tracksCount, const float *times)
+{
+    for (uint32_t i = 0; i < tracksCount; i++)
+    {
+        const float *trackTimes = times + tracks[i].firstKey;
+        for (uint32_t j = 0; j < tracks[i].keysCount; j++)
+        {
+            if (!isfinite(trackTimes[j]) || (j > 0 && trackTimes[j] < trackTimes[j - 1]))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Point the timeline to the sections of its data (data must be validated)
+static void CguiMapTimelineData(CguiTimeline *timeline)
+{
+    unsigned char *bytes = timeline->data;
+
+    timeline->header  = (CguiTimelineHeader *) bytes;
+    timeline->tracks  = (CguiTimelineTrack *) (bytes + sizeof(CguiTimelineHeader));
+    timeline->times   = (float *) (timeline->tracks + timeline->header->tracksCount);
+    timeline->easings = (unsigned int *) (timeline->times + timeline->header->keysCount);
+    timeline->values  = (float *) (timeline->easings + timeline->header->keysCount);
+
+    timeline->tracksCount = (int) timeline->header->tracksCount;
+}
+
+CguiTimeline *CguiCreateTimeline(int tracksCount, const int *keysCounts, const int *componentsCounts)
+{
+    if (tracksCount < 0 || (tracksCount > 0 && (!keysCounts || !componentsCounts)) || !CguiIsTimelineByteOrderNative())
+    {
+        return NULL;
+    }
+
+    // Counts are summed in 64 bits and limited like loaded data
+    uint64_t keysCount   = 0;
+    uint64_t valuesCount = 0;
+    for (int i = 0; i < tracksCount; i++)
+    {
+        if (keysCounts[i] < 0 || componentsCounts[i] < 1 || componentsCounts[i] > CGUI_TIMELINE_COMPONENTS_MAX)
+        {
+            CG_LOG_ERROR("Invalid track %d of timeline (%d keys of %d components)", i, keysCounts[i], componentsCounts[i]);
+            return NULL;
+        }
+
+        keysCount   += (uint64_t) keysCounts[i];
+        valuesCount += (uint64_t) keysCounts[i] * componentsCounts[i];
+
+        if (!CguiIsTimelineDataSizeValid((uint64_t) tracksCount, keysCount, valuesCount))
+        {
+            CG_LOG_ERROR("Timeline of %d tracks is too large", tracksCount);
+            return NULL;
+        }
+    }
+
+    CguiTimeline *timeline = CG_MALLOC_NULL(sizeof(CguiTimeline));
+    if (!timeline)
+    {
+        return NULL;
+    }
+
+    timeline->dataSize = (int) CguiGetTimelineDataSize((uint64_t) tracksCount, keysCount, valuesCount);
+    timeline->data     = CG_MALLOC_NULL(timeline->dataSize);
+    if (!timeline->data)
+    {
+        CG_FREE_NULL(timeline);
+        return NULL;
+    }
+
+    timeline->ownsData = true;
+
+    CguiTimelineHeader *header = timeline->data;
+    memcpy(header->magic, "CGTL", 4);
+    header->version     = CGUI_TIMELINE_VERSION;
+    header->tracksCount = (uint32_t) tracksCount;
+    header->keysCount   = (uint32_t) keysCount;
+    header->valuesCount = (uint32_t) valuesCount;
+    header->duration    = 0.0f;
+
+    CguiMapTimelineData(timeline);
+
+    // Keys are unset until set (comparisons with NaN times are false, so they do not constrain the order)
+    for (uint32_t i = 0; i < header->keysCount; i++)
+    {
+        timeline->times[i] = NAN;
+    }
+
+    // Keys and values of the tracks are laid out in order
+    uint32_t firstKey   = 0;
+    uint32_t firstValue = 0;
+    for (int i = 0; i < tracksCount; i++)
+    {
+        CguiTimelineTrack *track = &timeline->tracks[i];
+
+        track->firstKey   = firstKey;
+        track->keysCount  = keysCounts[i];
+        track->components = componentsCounts[i];
+        track->firstValue = firstValue;
+
+        firstKey   += track->keysCount;
+        firstValue += track->keysCount * track->components;
+    }
+
+    return timeline;
+}
+
+CguiTimeline *CguiLoadTimeline(const char *fileName)
+{
+    int            dataSize = 0;
+    unsigned char *data     = LoadFileData(fileName, &dataSize);
+    if (!data)
+    {
+        return NULL;
+    }
+
+    // Copied to be freed along with the timeline
+    void *copy = CG_MALLOC(dataSize);
+    if (!copy)
+    {
+        UnloadFileData(data);
+        return NULL;
+    }
+
+    memcpy(copy, data, dataSize);
+    UnloadFileData(data);
+
+    CguiTimeline *timeline = CguiLoadTimelineFromMemory(copy, dataSize);
+    if (!timeline)
+    {
+        CG_LOG_ERROR("Failed to load timeline \"%s\"", fileName);
+        CG_FREE_NULL(copy);
+        return NULL;
+    }
+
+    timeline->ownsData = true;
+
+    return timeline;
+}
+
+CguiTimeline *CguiLoadTimelineFromMemory(const void *data, int dataSize)
+{
+    if (!data || dataSize < (int) sizeof(CguiTimelineHeader) || !CguiIsTimelineByteOrderNative())
+    {
+        return NULL;
+    }
+
+    // Sections are read in place, they must be aligned for floats
+    if ((uintptr_t) data % sizeof(float) != 0)
+    {
+        CG_LOG_ERROR("Timeline data is not aligned to %d bytes", (int) sizeof(float));
+        return NULL;
+    }
+
+    const CguiTimelineHeader *header = data;
+    if (memcmp(header->magic, "CGTL", 4) != 0 || header->version != CGUI_TIMELINE_VERSION)
+    {
+        CG_LOG_ERROR("Timeline data is not in the timeline format (version %d)", CGUI_TIMELINE_VERSION);
+        return NULL;
+    }
+
+    if (!CguiIsTimelineDataSizeValid(header->tracksCount, header->keysCount, header->valuesCount)
+        || CguiGetTimelineDataSize(header->tracksCount, header->keysCount, header->valuesCount) > (uint64_t) dataSize)
+    {
+        CG_LOG_ERROR("Timeline data is truncated");
+        return NULL;
+    }
+
+    // Only the tracks and the key times are validated, values are evaluated without parsing
+    const CguiTimelineTrack *tracks = (const CguiTimelineTrack *) (header + 1);
+    for (uint32_t i = 0; i < header->tracksCount; i++)
+    {
+        const CguiTimelineTrack *track = &tracks[i];
+
+        if (track->components < 1 || track->components > CGUI_TIMELINE_COMPONENTS_MAX
+            || track->keysCount > header->keysCount || track->firstKey > header->keysCount - track->keysCount
+            || (uint64_t) track->keysCount * track->components > header->valuesCount
+            || track->firstValue > header->valuesCount - track->keysCount * track->components)
+        {
+            CG_LOG_ERROR("Track %u of timeline data is out of bounds", i);
+            return NULL;
+        }
+    }
+
+    // Optimization: Keys are validated once here, so evaluation can binary search them without checks
+    const float *times = (const float *) (tracks + header->tracksCount);
+    if (!CguiAreTimelineKeysValid(tracks, header->tracksCount, times))
+    {
+        CG_LOG_ERROR("Keys of timeline data are unset or out of order");
+        return NULL;
+    }
+
+    CguiTimeline *timeline = CG_MALLOC_NULL(sizeof(CguiTimeline));
+    if (!timeline)
+    {
+        return NULL;
+    }
+
+    timeline->data     = (void *) data;
+    timeline->dataSize = dataSize;
+
+    CguiMapTimelineData(timeline);
+
+    if (timeline->header->duration != CguiComputeTimelineDuration(timeline))
+    {
+        CG_LOG_ERROR("Duration of timeline data does not match its keys");
+        CG_FREE_NULL(timeline);
+        return NULL;
+    }
+
+    return timeline;
+}
+
+void CguiUnloadTimeline(CguiTimeline *timeline)
+{
+    if (!timeline)
+    {
+        return;
+    }
+
+    if (timeline->ownsData)
+    {
+        CG_FREE_NULL(timeline->data);
+    }
+
+    CG_FREE_NULL(timeline);
+}
+
+bool CguiExportTimeline(const CguiTimeline *timeline, const char *fileName)
+{
+    if (!timeline || !fileName)
+    {
+        return false;
+    }
+
+    // Exported data must load again
+    if (!CguiAreTimelineKeysValid(timeline->tracks, timeline->header->tracksCount, timeline->times))
+    {
+        CG_LOG_ERROR("Timeline has unset keys, it is not exported to \"%s\"", fileName);
+        return false;
+    }
+
+    return SaveFileData(fileName, timeline->data, timeline->dataSize);
+}
+
+bool CguiSetTimelineKey(CguiTimeline *timeline, int track, int key, float time, const float *value, int easing)
+{
+    // Data loaded from memory is not owned, and may be read-only (e.g., memory-mapped)
+    if (!timeline || !timeline->ownsData || !value || track < 0 || track >= timeline->tracksCount)
+    {
+        return false;
+    }
+
+    CguiTimelineTrack *tl = &timeline->tracks[track];
+    if (key < 0 || key >= (int) tl->keysCount)
+    {
+        return false;
+    }
+
+    // Keys are kept sorted for the binary search, unset keys around are skipped to the nearest set keys
+    float *times    = timeline->times + tl->firstKey;
+    int    previous = key - 1;
+    int    next     = key + 1;
+    while (previous >= 0 && isnan(times[previous]))
+    {
+        previous--;
+    }
+
+    while (next < (int) tl->keysCount && isnan(times[next]))
+    {
+        next++;
+    }
+
+    if (!isfinite(time) || (previous >= 0 && time < times[previous]) || (next < (int) tl->keysCount && time > times[next]))
+    {
+        CG_LOG_ERROR("Key %d of timeline track %d is set out of order with the set keys", key, track);
+        return false;
+    }
+
+    times[key]                            = time;
+    timeline->easings[tl->firstKey + key] = (unsigned int) easing;
+    memcpy(timeline->values + tl->firstValue + key * tl->components, value, sizeof(float) * tl->components);
+
+    // Moving the last key earlier may shorten the timeline
+    timeline->header->duration = CguiComputeTimelineDuration(timeline);
+
+    return true;
+}
+
+int CguiGetTimelineTrackComponents(const CguiTimeline *timeline, int track)
+{
+    if (!timeline || track < 0 || track >= timeline->tracksCount)
+    {
+        return 0;
+    }
+
+    return (int) timeline->tracks[track].components;
+}
+
+float CguiGetTimelineDuration(const CguiTimeline *timeline)
+{
+    if (!timeline)
+    {
+        return 0.0f;
+    }
+
+    return timeline->header->duration;
+}
+
+bool CguiEvalTimelineTrack(const CguiTimeline *timeline, int track, float time, float *out)
+{
+    if (!timeline || !out || track < 0 || track >= timeline->tracksCount)
+    {
+        return false;
+    }
+
+    const CguiTimelineTrack *tl = &timeline->tracks[track];
+    if (tl->keysCount == 0)
+    {
+        return false;
+    }
+
+    const float *times      = timeline->times + tl->firstKey;
+    const float *values     = timeline->values + tl->firstValue;
+    int          components = (int) tl->components;
+    int          last       = (int) tl->keysCount - 1;
+
+    // Held at the first and the last keys
+    if (!(time > times[0]))
+    {
+        memcpy(out, values, sizeof(float) * components);
+        return true;
+    }
+
+    if (time >= times[last])
+    {
+        memcpy(out, values + last * components, sizeof(float) * components);
+        return true;
+    }
+
+    // Binary search for the segment, times[low] <= time < times[high]
+    int low  = 0;
+    int high = last;
+    while (high - low > 1)
+    {
+        int middle = low + (high - low) / 2;
+        if (times[middle] <= time)
+            low = middle;
+        else
+            high = middle;
+    }
+
+    // Easing of a key eases the segment from the key to the next key
+    float              span   = times[high] - times[low];
+    float              t      = span > 0.0f ? (time - times[low]) / span : 1.0f;
+    CguiEasingFunction easing = CguiGetEasingFunction((int) timeline->easings[tl->firstKey + low]);
+    if (easing)
+    {
+        t = easing(t);
+    }
+
+    const float *from = values + low * components;
+    const float *to   = values + high * components;
+    for (int i = 0; i < components; i++)
+    {
+        out[i] = from[i] + (to[i] - from[i]) * t;
+    }
+
+    return true;
+}
+
+void CguiEvalTimeline(const CguiTimeline *timeline, float time, float *const *outs)
+{
+    if (!timeline || !outs)
+    {
+        return;
+    }
+
+    for (int i = 0; i < timeline->tracksCount; i++)
+    {
+        if (outs[i])
+        {
+            CguiEvalTimelineTrack(timeline, i, time, outs[i]);
+        }
+    }
+}
@@ -10,21 +10,167 @@
 /// This project is licensed under the terms of MIT license.
 
 #include <math.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "crystalgui/crystalgui.h"
 #include "raylib.h"
 #include "raymath.h"
 
+// SIMD instruction sets for batch interpolation (define CG_NO_SIMD to use scalar only)
+#ifndef CG_NO_SIMD
+#if defined(__AVX__)
+#include <immintrin.h>
+#define CGUI_SIMD_AVX
+#endif
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define CGUI_SIMD_SSE
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CGUI_SIMD_NEON
+#endif
+#endif // CG_NO_SIMD
+
+// How the interpolated value of a lane is stored
+enum CguiInterpLaneKind {
+    CGUI_INTERP_LANE_FLOAT, // Stored as float
+    CGUI_INTERP_LANE_SIZE,  // Stored as float, not less than 0
+    CGUI_INTERP_LANE_BYTE,  // Stored as unsigned char (t must be clamped)
+};
+
+// Angular frequency times the duration for a spring to come within 1% of the target (from rest)
+#define CGUI_SPRING_SETTLE_FACTOR 6.64f
+
+// Distance from the target under which a spring lane comes to rest (speed is scaled by the frequency)
+#ifndef CGUI_SPRING_REST_THRESHOLD
+#define CGUI_SPRING_REST_THRESHOLD 0.01f
+#endif
+
 struct CguiRegisteredTransitionChain;
 typedef struct CguiRegisteredTransitionChain CguiRegisteredTransitionChain;
 
 struct CguiRegisteredTransitionChain {
-    CguiTransitionChain           *chain;
-    CguiRegisteredTransitionChain *next;
+    CguiTransitionChain *chain; // Registered chain
+    int                  slot;  // Slot of the chain in the registry
+};
+
+struct CguiTransitionSlot;
+typedef struct CguiTransitionSlot CguiTransitionSlot;
+
+struct CguiTransitionSlot {
+    int          registered; // Index of the registered chain in this slot (-1 if free)
+    unsigned int generation; // Current generation of this slot (never 0)
+    int          nextFree;   // Next free slot (-1 for none), if free
+};
+
+union CguiTransitionPoolItem;
+typedef union CguiTransitionPoolItem CguiTransitionPoolItem;
+
+// Transitions and chains share the pool, so a chain and its first transition
+// created together are adjacent in memory
+union CguiTransitionPoolItem {
+    CguiTransition          transition; // Transition, if used
+    CguiTransitionChain     chain;      // Transition chain, if used
+    CguiTransitionPoolItem *nextFree;   // Next free item (NULL for none), if free
 };
 
 extern CguiRegisteredTransitionChain *cguiRegisteredTransitionChains;
+extern int                            cguiRegisteredTransitionChainsCount;
+extern int                            cguiRegisteredTransitionChainsCapacity;
+extern CguiTransitionSlot            *cguiTransitionSlots;
+extern int                            cguiTransitionSlotsCount;
+extern int                            cguiTransitionSlotsCapacity;
+extern int                            cguiTransitionFreeSlot;
+extern CguiTransitionPoolItem       **cguiTransitionPoolPages;
+extern int                            cguiTransitionPoolPagesCount;
+extern int                            cguiTransitionPoolPagesCapacity;
+extern CguiTransitionPoolItem        *cguiTransitionPoolFree;
+extern int                            cguiTransitionPoolUsed;
+extern float                         *cguiInterpLanesFrom;
+extern float                         *cguiInterpLanesTo;
+extern float                         *cguiInterpLanesT;
+extern void                         **cguiInterpLanesResult;
+extern unsigned char                 *cguiInterpLanesKind;
+extern int                            cguiInterpLanesCount;
+extern int                            cguiInterpLanesCapacity;
+extern int                            cguiTransitionBatchDepth;
+extern CguiTimeFunction               cguiTransitionTimeFunction;
+extern bool                           cguiTransitionClockStarted;
+extern double                         cguiTransitionLastTime;
+extern double                         cguiTransitionAccumulator;
+extern float                          cguiTransitionDeltaTime;
+extern float                          cguiTransitionStepTime;
+extern int                            cguiTransitionStepsCount;
+extern float                          cguiTransitionFixedStep;
+extern CguiTransitionChain          **cguiScheduledChains;
+extern int                            cguiScheduledChainsCount;
+extern int                            cguiScheduledChainsCapacity;
+
+// Maximum number of fixed steps in an update, the time of the steps over it is dropped (chains fall behind instead of catching up)
+#ifndef CGUI_TRANSITION_STEPS_MAX
+#define CGUI_TRANSITION_STEPS_MAX 8
+#endif
+
+// Number of transitions and chains allocated at once by the pool
+#ifndef CGUI_TRANSITION_POOL_PAGE_SIZE
+#define CGUI_TRANSITION_POOL_PAGE_SIZE 64
+#endif
+
+// Get a zeroed item from the pool, NULL on failure
+static CguiTransitionPoolItem *CguiAcquirePoolItem(void)
+{
+    if (!cguiTransitionPoolFree)
+    {
+        // Resize capacity if full
+        if (cguiTransitionPoolPagesCount == cguiTransitionPoolPagesCapacity)
+        {
+            int                      newCapacity = (cguiTransitionPoolPagesCapacity == 0) ? 8 : (cguiTransitionPoolPagesCapacity * 2);
+            CguiTransitionPoolItem **newPages    = CG_REALLOC(cguiTransitionPoolPages, sizeof(CguiTransitionPoolItem *) * newCapacity);
+            if (!newPages)
+            {
+                return NULL;
+            }
+
+            cguiTransitionPoolPages         = newPages;
+            cguiTransitionPoolPagesCapacity = newCapacity;
+        }
+
+        CguiTransitionPoolItem *page = CG_MALLOC(sizeof(CguiTransitionPoolItem) * CGUI_TRANSITION_POOL_PAGE_SIZE);
+        if (!page)
+        {
+            return NULL;
+        }
+
+        cguiTransitionPoolPages[cguiTransitionPoolPagesCount++] = page;
+
+        // Reverse order, so the items are handed out in address order
+        for (int i = CGUI_TRANSITION_POOL_PAGE_SIZE - 1; i >= 0; i--)
+        {
+            page[i].nextFree       = cguiTransitionPoolFree;
+            cguiTransitionPoolFree = &page[i];
+        }
+    }
+
+    CguiTransitionPoolItem *item = cguiTransitionPoolFree;
+    cguiTransitionPoolFree       = item->nextFree;
+    cguiTransitionPoolUsed++;
+
+    memset(item, 0, sizeof(CguiTransitionPoolItem));
+    return item;
+}
+
+// Return an item to the pool
+static void CguiReleasePoolItem(CguiTransitionPoolItem *item)
+{
+    item->nextFree         = cguiTransitionPoolFree;
+    cguiTransitionPoolFree = item;
+    cguiTransitionPoolUsed--;
+}
+
+static bool CguiDeferInterp(CguiTransition *transition, float t);
 
 int CguiInterpInt(int a, int b, float t)
 {
@@ -66,66 +212,35 @@ Color CguiInterpColor(Color a, Color b, float t)
 Rectangle CguiInterpRectangle(Rectangle a, Rectangle b, float t)
 {
     Rectangle result;
-    result.x = a.x + (b.x - a.x) * t;
-    result.y = a.y + (b.y - a.y) * t;
-
-    // Size should not be < 0.0f
-    result.width  = fmaxf(a.width + (b.width - a.width) * t, 0.0f);
-    result.height = fmaxf(a.height + (b.height - a.height) * t, 0.0f);
+    CguiInterpRectangleP(&a, &b, t, &result);
     return result;
 }
 
 CguiTransformation CguiInterpTransformation(CguiTransformation a, CguiTransformation b, float t)
 {
     CguiTransformation result;
-    result.position           = CguiInterpVector2(a.position, b.position, t);
-    result.size               = Vector2Max(CguiInterpVector2(a.size, b.size, t), Vector2Zero()); // Prevent negative size
-    result.isRelativePosition = CguiInterpVector2(a.isRelativePosition, b.isRelativePosition, t);
-    result.isRelativeSize     = CguiInterpVector2(a.isRelativeSize, b.isRelativeSize, t);
-    result.anchor             = CguiInterpVector2(a.anchor, b.anchor, t);
-    result.shrink             = CguiInterpVector2(a.shrink, b.shrink, t);
+    CguiInterpTransformationP(&a, &b, t, &result);
     return result;
 }
 
 CguiTextElementData CguiInterpTextElementData(CguiTextElementData a, CguiTextElementData b, float t)
 {
     CguiTextElementData result;
-    result.text        = t <= 0.5f ? a.text : b.text;
-    result.font        = t <= 0.5f ? a.font : b.font;
-    result.fontSize    = CguiInterpFloat(a.fontSize, b.fontSize, t);
-    result.spacing     = CguiInterpFloat(a.spacing, b.spacing, t);
-    result.lineSpacing = CguiInterpFloat(a.lineSpacing, b.lineSpacing, t);
-    result.color       = CguiInterpColor(a.color, b.color, t);
-    result.xJustify    = t <= 0.5f ? a.xJustify : b.xJustify;
-    result.yJustify    = t <= 0.5f ? a.yJustify : b.yJustify;
+    CguiInterpTextElementDataP(&a, &b, t, &result);
     return result;
 }
 
 CguiTextureElementData CguiInterpTextureElementData(CguiTextureElementData a, CguiTextureElementData b, float t)
 {
     CguiTextureElementData result;
-    result.texture  = t <= 0.5f ? a.texture : b.texture;
-    result.source   = CguiInterpRectangle(a.source, b.source, t);
-    result.origin   = CguiInterpVector2(a.origin, b.origin, t);
-    result.rotation = CguiInterpFloat(a.rotation, b.rotation, t);
-    result.tint     = CguiInterpColor(a.tint, b.tint, t);
+    CguiInterpTextureElementDataP(&a, &b, t, &result);
     return result;
 }
 
 CguiBoxElementData CguiInterpBoxElementData(CguiBoxElementData a, CguiBoxElementData b, float t)
 {
     CguiBoxElementData result;
-    result.radii           = CguiInterpVector4(a.radii, b.radii, t);
-    result.color           = CguiInterpColor(a.color, b.color, t);
-    result.texture         = t <= 0.5f ? a.texture : b.texture;
-    result.shadowDistance  = CguiInterpFloat(a.shadowDistance, b.shadowDistance, t);
-    result.shadowOffset    = CguiInterpVector2(a.shadowOffset, b.shadowOffset, t);
-    result.shadowShrink    = CguiInterpFloat(a.shadowShrink, b.shadowShrink, t);
-    result.shadowColor     = CguiInterpColor(a.shadowColor, b.shadowColor, t);
-    result.shadowTexture   = t <= 0.5f ? a.shadowTexture : b.shadowTexture;
-    result.borderThickness = CguiInterpFloat(a.borderThickness, b.borderThickness, t);
-    result.borderColor     = CguiInterpColor(a.borderColor, b.borderColor, t);
-    result.borderTexture   = t <= 0.5f ? a.borderTexture : b.borderTexture;
+    CguiInterpBoxElementDataP(&a, &b, t, &result);
     return result;
 }
 
@@ -141,12 +256,14 @@ CguiTransition *CguiCreateTransitionEx(const void *from, const void *to, void *r
 
 CguiTransition *CguiCreateTransitionPro(const void *from, const void *to, void *result, CguiInterpFunction interp, CguiEasingFunction easing, float delayBefore, float duration, float delayAfter, bool reversed, int repeatCount)
 {
-    CguiTransition *transition = CG_MALLOC_NULL(sizeof(CguiTransition));
-    if (!transition)
+    CguiTransitionPoolItem *item = CguiAcquirePoolItem();
+    if (!item)
     {
         return NULL;
     }
 
+    CguiTransition *transition = &item->transition;
+
     transition->from        = from;
     transition->to          = to;
     transition->result      = result;
@@ -168,18 +285,19 @@ void CguiDeleteTransition(CguiTransition *transition)
         return;
     }
 
-    CG_FREE_NULL(transition);
+    CG_FREE_NULL(transition->springState);
+    CguiReleasePoolItem((CguiTransitionPoolItem *) transition);
 }
 
 CguiTransitionChain *CguiCreateTransitionChain(void)
 {
-    CguiTransitionChain *chain = CG_MALLOC_NULL(sizeof(CguiTransitionChain));
-    if (!chain)
+    CguiTransitionPoolItem *item = CguiAcquirePoolItem();
+    if (!item)
     {
         return NULL;
     }
 
-    return chain;
+    return &item->chain;
 }
 
 void CguiDeleteTransitionChain(CguiTransitionChain *chain)
@@ -207,7 +325,91 @@ void CguiDeleteTransitionChainSelf(CguiTransitionChain *chain)
         return;
     }
 
-    CG_FREE_NULL(chain);
+    CguiUnscheduleTransitionChain(chain);
+    CguiUnregisterAutoTransitionChain(chain);
+
+    CguiReleasePoolItem((CguiTransitionPoolItem *) chain);
+}
+
+// Pointer at the same offset in the to memory, if the pointer is within the from memory
+static void *CguiRebaseTransitionValue(const void *value, const void *fromBase, void *toBase, int size)
+{
+    uintptr_t address = (uintptr_t) value;
+    uintptr_t from    = (uintptr_t) fromBase;
+    if (!value || !fromBase || !toBase || address < from || address >= from + (uintptr_t) size)
+    {
+        return (void *) value;
+    }
+
+    return (unsigned char *) toBase + (address - from);
+}
+
+CguiTransitionChain *CguiCloneTransitionChain(CguiTransitionChain *chain, const void *fromBase, void *toBase, int size)
+{
+    if (!chain)
+    {
+        return NULL;
+    }
+
+    CguiTransitionChain *clone = CguiCreateTransitionChain();
+    if (!clone)
+    {
+        return NULL;
+    }
+
+    for (CguiTransition *transition = chain->first; transition; transition = transition->next)
+    {
+        CguiTransition *copy = CguiCreateTransition();
+        if (!copy)
+        {
+            CguiDeleteTransitionChain(clone);
+            return NULL;
+        }
+
+        *copy             = *transition;
+        copy->from        = CguiRebaseTransitionValue(transition->from, fromBase, toBase, size);
+        copy->to          = CguiRebaseTransitionValue(transition->to, fromBase, toBase, size);
+        copy->result      = CguiRebaseTransitionValue(transition->result, fromBase, toBase, size);
+        copy->prev        = NULL;
+        copy->next        = NULL;
+        copy->autoChain   = NULL;
+        copy->springState = NULL;
+
+        // Springs keep their motion
+        if (transition->springState)
+        {
+            copy->springState = CG_MALLOC_NULL(sizeof(float) * transition->springLanesCount * 2);
+            if (!copy->springState)
+            {
+                CguiDeleteTransition(copy);
+                CguiDeleteTransitionChain(clone);
+                return NULL;
+            }
+
+            memcpy(copy->springState, transition->springState, sizeof(float) * transition->springLanesCount * 2);
+        }
+
+        CguiInsertTransition(clone, copy);
+
+        if (chain->active == transition)
+        {
+            clone->active = copy;
+        }
+    }
+
+    clone->paused        = chain->paused;
+    clone->activeRepeats = chain->activeRepeats;
+    clone->activeTime    = chain->activeTime;
+    clone->finished      = chain->finished;
+
+    // Running chain continues along with the cloned chain
+    if (chain->scheduledSlot != 0 && !CguiScheduleTransitionChain(clone))
+    {
+        CguiDeleteTransitionChain(clone);
+        return NULL;
+    }
+
+    return clone;
 }
 
 bool CguiInsertTransition(CguiTransitionChain *chain, CguiTransition *transition)
@@ -455,9 +657,36 @@ int CguiGetTransitionsCount(CguiTransitionChain *chain)
     return count;
 }
 
+int CguiGetPooledTransitionsCount(void)
+{
+    return cguiTransitionPoolUsed;
+}
+
+bool CguiTrimTransitionPool(void)
+{
+    // Pages cannot be freed while any of their items are in use
+    if (cguiTransitionPoolUsed > 0)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < cguiTransitionPoolPagesCount; i++)
+    {
+        CG_FREE(cguiTransitionPoolPages[i]);
+    }
+
+    CG_FREE_NULL(cguiTransitionPoolPages);
+    cguiTransitionPoolPagesCount    = 0;
+    cguiTransitionPoolPagesCapacity = 0;
+    cguiTransitionPoolFree          = NULL;
+
+    return true;
+}
+
 void CguiUpdateTransition(CguiTransition *transition, float elapsedTime)
 {
-    if (!transition || !transition->interp)
+    // Springs are stepped by the passed time instead
+    if (!transition || !transition->interp || transition->kind == CGUI_TRANSITION_KIND_SPRING)
     {
         return;
     }
@@ -474,15 +703,30 @@ void CguiUpdateTransition(CguiTransition *transition, float elapsedTime)
 
     float t = Clamp(transition->duration == 0.0f ? 0.5f : localTime / transition->duration, 0.0f, 1.0f);
 
-    if (transition->easing)
+    if (transition->easingTable)
+    {
+        t = CguiEvalEasingTable(transition->easingTable, t);
+    }
+    else if (transition->easing)
     {
         t = transition->easing(t);
     }
 
+    // Interpolated along with the other transitions when the batch ends
+    if (cguiTransitionBatchDepth > 0 && CguiDeferInterp(transition, t))
+    {
+        return;
+    }
+
     transition->interp(transition->from, transition->to, t, transition->result);
 }
 
 void CguiUpdateTransitionChain(CguiTransitionChain *chain)
+{
+    CguiAdvanceTransitionChain(chain, cguiTransitionStepTime);
+}
+
+void CguiAdvanceTransitionChain(CguiTransitionChain *chain, float deltaTime)
 {
     if (!chain || chain->paused)
     {
@@ -499,170 +743,455 @@ void CguiUpdateTransitionChain(CguiTransitionChain *chain)
         chain->active = chain->first;
     }
 
-    CguiTransition *active = chain->active;
+    chain->activeTime += deltaTime;
+
+    // Multiple transitions may end in one update (e.g., after a long frame)
+    while (chain->active)
+    {
+        CguiTransition *active = chain->active;
+
+        // Springs have no fixed duration, they run until at rest
+        if (active->kind == CGUI_TRANSITION_KIND_SPRING)
+        {
+            bool resting      = CguiStepSpringTransition(active, chain->activeTime);
+            chain->activeTime = 0.0f;
+
+            if (!resting)
+            {
+                return;
+            }
+
+            chain->active        = active->next;
+            chain->activeRepeats = 0;
+            continue;
+        }
+
+        float segmentTime = active->delayBefore + active->duration + active->delayAfter;
+
+        if (chain->activeTime < segmentTime)
+        {
+            CguiUpdateTransition(active, chain->activeTime);
+            return;
+        }
+        else
+        {
+            active->interp(active->from, active->to, active->reversed ? 0.0f : 1.0f, active->result);
+        }
 
-    float segmentTime = active->delayBefore + active->duration + active->delayAfter;
+        if (active->repeatCount == -1)
+        {
+            // Keep leftover time to allow smoother "continuousness", skipping the whole repeats
+            chain->activeTime = segmentTime > 0.0f ? fmodf(chain->activeTime, segmentTime) : 0.0f;
+            chain->activeRepeats++;
+            CguiUpdateTransition(active, chain->activeTime);
+            return;
+        }
 
-    chain->activeTime += 1.0f / 60.0f;
+        chain->activeTime -= segmentTime;
+
+        if (chain->activeRepeats + 1 < active->repeatCount)
+        {
+            chain->activeRepeats++;
+            continue;
+        }
+
+        chain->active        = active->next;
+        chain->activeRepeats = 0;
+    }
+
+    chain->finished = true;
+}
 
-    if (chain->activeTime < segmentTime)
+bool CguiScheduleTransitionChain(CguiTransitionChain *chain)
+{
+    if (!chain)
     {
-        CguiUpdateTransition(active, chain->activeTime);
-        return;
+        return false;
     }
-    else
+
+    // Optimization: Already scheduled
+    if (chain->scheduledSlot != 0)
+    {
+        return true;
+    }
+
+    // Resize capacity if full
+    if (cguiScheduledChainsCount == cguiScheduledChainsCapacity)
     {
-        active->interp(active->from, active->to, active->reversed ? 0.0f : 1.0f, active->result);
+        int                   newCapacity = (cguiScheduledChainsCapacity == 0) ? 16 : (cguiScheduledChainsCapacity * 2);
+        CguiTransitionChain **newChains   = CG_REALLOC(cguiScheduledChains, sizeof(CguiTransitionChain *) * newCapacity);
+        if (!newChains)
+        {
+            CG_LOG_ERROR("Failed to grow scheduled transitions to %d chains", newCapacity);
+            return false;
+        }
+
+        cguiScheduledChains         = newChains;
+        cguiScheduledChainsCapacity = newCapacity;
     }
 
-    chain->activeTime -= segmentTime;
+    cguiScheduledChains[cguiScheduledChainsCount++] = chain;
+    chain->scheduledSlot                            = cguiScheduledChainsCount;
+
+    return true;
+}
 
-    if (active->repeatCount == -1 || chain->activeRepeats + 1 < active->repeatCount)
+void CguiUnscheduleTransitionChain(CguiTransitionChain *chain)
+{
+    if (!chain || chain->scheduledSlot == 0)
     {
-        chain->activeRepeats++;
-        // Keep leftover time to allow smoother "continuousness", so it does not accumulate leftover time
-        CguiUpdateTransition(active, chain->activeTime);
         return;
     }
 
-    chain->active        = active->next;
+    // Order does not matter, move the last chain in place of removed chain
+    int                  index = chain->scheduledSlot - 1;
+    CguiTransitionChain *last  = cguiScheduledChains[--cguiScheduledChainsCount];
+
+    cguiScheduledChains[index] = last;
+    last->scheduledSlot        = index + 1;
+    chain->scheduledSlot       = 0;
+}
+
+void CguiRestartTransitionChain(CguiTransitionChain *chain)
+{
+    if (!chain)
+    {
+        return;
+    }
+
+    chain->active        = chain->first;
+    chain->activeTime    = 0.0f;
     chain->activeRepeats = 0;
+    chain->finished      = false;
 
-    if (!chain->active)
+    for (CguiTransition *transition = chain->first; transition; transition = transition->next)
     {
-        chain->finished = true;
+        CguiResetSpringTransition(transition);
     }
+
+    CguiScheduleTransitionChain(chain);
 }
 
-void CguiRegisterAutoTransition(CguiTransition *transition)
+void CguiRetargetTransitionChain(CguiTransitionChain *chain)
 {
-    if (!transition)
+    if (!chain)
     {
         return;
     }
 
-    CguiRegisteredTransitionChain *newRegister = CG_MALLOC_NULL(sizeof(CguiRegisteredTransitionChain));
-    if (!newRegister)
+    // Finished chains continue from the last transition
+    CguiTransition *transition = chain->active;
+    if (chain->finished)
     {
+        transition = chain->last;
+    }
+    else if (!transition)
+    {
+        transition = chain->first;
+    }
+
+    if (!transition || transition->kind != CGUI_TRANSITION_KIND_SPRING)
+    {
+        CguiRestartTransitionChain(chain);
         return;
     }
 
-    newRegister->chain = CguiCreateTransitionChain();
-    if (!newRegister->chain)
+    // Optimization: The spring reads the target as it steps, its motion is kept
+    chain->active        = transition;
+    chain->activeTime    = 0.0f;
+    chain->activeRepeats = 0;
+    chain->finished      = false;
+
+    CguiScheduleTransitionChain(chain);
+}
+
+void CguiUpdateScheduledTransitions(void)
+{
+    CguiBeginTransitionBatch();
+
+    // Reverse order, so an unscheduled chain is replaced by an already updated chain
+    for (int i = cguiScheduledChainsCount - 1; i >= 0; i--)
+    {
+        CguiTransitionChain *chain = cguiScheduledChains[i];
+
+        CguiUpdateTransitionChain(chain);
+        if (chain->finished)
+        {
+            CguiUnscheduleTransitionChain(chain);
+        }
+    }
+
+    CguiEndTransitionBatch();
+}
+
+int CguiGetScheduledTransitionsCount(void)
+{
+    return cguiScheduledChainsCount;
+}
+
+void CguiTickTransitionClock(void)
+{
+    double time = cguiTransitionTimeFunction ? cguiTransitionTimeFunction() : GetTime();
+
+    // First tick only starts the clock
+    if (!cguiTransitionClockStarted)
     {
+        cguiTransitionClockStarted = true;
+        cguiTransitionLastTime     = time;
+        cguiTransitionDeltaTime    = 0.0f;
+        cguiTransitionStepTime     = 0.0f;
+        cguiTransitionStepsCount   = 0;
         return;
     }
 
-    if (!CguiInsertTransition(newRegister->chain, transition))
+    // Time source going back does not rewind
+    double passed          = fmax(time - cguiTransitionLastTime, 0.0);
+    cguiTransitionLastTime = time;
+
+    if (cguiTransitionFixedStep <= 0.0f)
     {
-        CguiDeleteTransitionChain(newRegister->chain);
+        cguiTransitionDeltaTime  = (float) passed;
+        cguiTransitionStepTime   = (float) passed;
+        cguiTransitionStepsCount = 1;
         return;
     }
 
-    newRegister->next              = cguiRegisteredTransitionChains;
-    cguiRegisteredTransitionChains = newRegister;
+    // Leftover time is kept for the next tick
+    cguiTransitionAccumulator += passed;
+
+    double steps               = floor(cguiTransitionAccumulator / cguiTransitionFixedStep);
+    cguiTransitionAccumulator -= steps * cguiTransitionFixedStep;
+    cguiTransitionStepsCount   = (int) fmin(steps, CGUI_TRANSITION_STEPS_MAX);
+    cguiTransitionStepTime     = cguiTransitionStepsCount > 0 ? cguiTransitionFixedStep : 0.0f;
+    cguiTransitionDeltaTime    = cguiTransitionStepsCount * cguiTransitionFixedStep;
+}
+
+void CguiResetTransitionClock(void)
+{
+    cguiTransitionClockStarted = false;
+    cguiTransitionDeltaTime    = 0.0f;
+    cguiTransitionStepTime     = 0.0f;
+    cguiTransitionStepsCount   = 0;
+    cguiTransitionAccumulator  = 0.0;
+}
+
+void CguiSetTransitionTimeFunction(CguiTimeFunction function)
+{
+    cguiTransitionTimeFunction = function;
+    CguiResetTransitionClock();
+}
+
+void CguiSetTransitionFixedStep(float step)
+{
+    cguiTransitionFixedStep   = fmaxf(step, 0.0f);
+    cguiTransitionAccumulator = 0.0;
+}
+
+float CguiGetTransitionDeltaTime(void)
+{
+    return cguiTransitionDeltaTime;
+}
+
+int CguiGetTransitionStepsCount(void)
+{
+    return cguiTransitionStepsCount;
+}
+
+// Get a free registry slot, -1 on failure
+static int CguiAcquireTransitionSlot(void)
+{
+    int slot = cguiTransitionFreeSlot;
+    if (slot != -1)
+    {
+        cguiTransitionFreeSlot = cguiTransitionSlots[slot].nextFree;
+        return slot;
+    }
+
+    // Resize capacity if full
+    if (cguiTransitionSlotsCount == cguiTransitionSlotsCapacity)
+    {
+        int                 newCapacity = (cguiTransitionSlotsCapacity == 0) ? 64 : (cguiTransitionSlotsCapacity * 2);
+        CguiTransitionSlot *newSlots    = CG_REALLOC(cguiTransitionSlots, sizeof(CguiTransitionSlot) * newCapacity);
+        if (!newSlots)
+        {
+            return -1;
+        }
+
+        cguiTransitionSlots         = newSlots;
+        cguiTransitionSlotsCapacity = newCapacity;
+    }
+
+    slot                                 = cguiTransitionSlotsCount++;
+    cguiTransitionSlots[slot].generation = 1;
+
+    return slot;
 }
 
-void CguiRegisterAutoTransitionChain(CguiTransitionChain *chain)
+// Remove the chain from the registry (without deleting it)
+static void CguiRemoveRegisteredChain(CguiTransitionChain *chain)
 {
+    CguiTransitionSlot *slot  = &cguiTransitionSlots[chain->registeredSlot - 1];
+    int                 index = slot->registered;
+
+    // Order does not matter, move the last chain in place of removed chain
+    CguiRegisteredTransitionChain last        = cguiRegisteredTransitionChains[--cguiRegisteredTransitionChainsCount];
+    cguiRegisteredTransitionChains[index]     = last;
+    cguiTransitionSlots[last.slot].registered = index;
+
+    slot->registered = -1;
+    slot->generation++;
+    if (slot->generation == 0) slot->generation = 1; // Generation 0 is never valid
+    slot->nextFree = cguiTransitionFreeSlot;
+
+    cguiTransitionFreeSlot = chain->registeredSlot - 1;
+    chain->registeredSlot  = 0;
+}
+
+CguiTransitionHandle CguiRegisterAutoTransition(CguiTransition *transition)
+{
+    if (!transition || transition->autoChain)
+    {
+        return (CguiTransitionHandle) { 0 };
+    }
+
+    CguiTransitionChain *chain = CguiCreateTransitionChain();
     if (!chain)
     {
-        return;
+        return (CguiTransitionHandle) { 0 };
+    }
+
+    if (!CguiInsertTransition(chain, transition))
+    {
+        CguiDeleteTransitionChainSelf(chain);
+        return (CguiTransitionHandle) { 0 };
     }
 
-    CguiRegisteredTransitionChain *newRegister = CG_MALLOC_NULL(sizeof(CguiRegisteredTransitionChain));
-    if (!newRegister)
+    CguiTransitionHandle handle = CguiRegisterAutoTransitionChain(chain);
+    if (handle.generation == 0)
     {
-        return;
+        CguiRemoveTransition(chain, transition);
+        CguiDeleteTransitionChainSelf(chain);
+        return (CguiTransitionHandle) { 0 };
     }
 
-    newRegister->chain             = chain;
-    newRegister->next              = cguiRegisteredTransitionChains;
-    cguiRegisteredTransitionChains = newRegister;
+    transition->autoChain = chain;
+
+    return handle;
 }
 
-void CguiUnregisterAutoTransition(CguiTransition *transition)
+CguiTransitionHandle CguiRegisterAutoTransitionChain(CguiTransitionChain *chain)
 {
-    if (!transition)
+    if (!chain)
     {
-        return;
+        return (CguiTransitionHandle) { 0 };
     }
 
-    CguiRegisteredTransitionChain *current  = cguiRegisteredTransitionChains;
-    CguiRegisteredTransitionChain *previous = NULL;
+    if (chain->registeredSlot != 0)
+    {
+        CguiTransitionSlot *slot = &cguiTransitionSlots[chain->registeredSlot - 1];
+        return (CguiTransitionHandle) { .index = chain->registeredSlot - 1, .generation = slot->generation };
+    }
 
-    while (current)
+    // Resize capacity if full
+    if (cguiRegisteredTransitionChainsCount == cguiRegisteredTransitionChainsCapacity)
     {
-        if (current->chain->first == transition)
+        int                            newCapacity = (cguiRegisteredTransitionChainsCapacity == 0) ? 64 : (cguiRegisteredTransitionChainsCapacity * 2);
+        CguiRegisteredTransitionChain *newChains   = CG_REALLOC(cguiRegisteredTransitionChains, sizeof(CguiRegisteredTransitionChain) * newCapacity);
+        if (!newChains)
         {
-            if (previous)
-            {
-                previous->next = current->next;
-            }
-            else
-            {
-                cguiRegisteredTransitionChains = current->next;
-            }
-
-            CguiRemoveTransition(current->chain, transition);
-            CguiDeleteTransitionChain(current->chain);
-            CG_FREE_NULL(current);
-            break;
+            CG_LOG_ERROR("Failed to grow auto transitions to %d chains", newCapacity);
+            return (CguiTransitionHandle) { 0 };
         }
 
-        previous = current;
-        current  = current->next;
+        cguiRegisteredTransitionChains         = newChains;
+        cguiRegisteredTransitionChainsCapacity = newCapacity;
+    }
+
+    int slot = CguiAcquireTransitionSlot();
+    if (slot == -1)
+    {
+        CG_LOG_ERROR("Failed to grow auto transition slots");
+        return (CguiTransitionHandle) { 0 };
+    }
+
+    int index                             = cguiRegisteredTransitionChainsCount++;
+    cguiRegisteredTransitionChains[index] = (CguiRegisteredTransitionChain) { .chain = chain, .slot = slot };
+
+    cguiTransitionSlots[slot].registered = index;
+    cguiTransitionSlots[slot].nextFree   = -1;
+    chain->registeredSlot                = slot + 1;
+
+    return (CguiTransitionHandle) { .index = slot, .generation = cguiTransitionSlots[slot].generation };
+}
+
+void CguiUnregisterAutoTransition(CguiTransition *transition)
+{
+    if (!transition || !transition->autoChain)
+    {
+        return;
     }
+
+    // Transition is left to the caller, only the created chain is deleted
+    CguiTransitionChain *chain = transition->autoChain;
+    transition->autoChain      = NULL;
+
+    CguiRemoveTransition(chain, transition);
+    CguiDeleteTransitionChain(chain);
 }
 
 void CguiUnregisterAutoTransitionChain(CguiTransitionChain *chain)
 {
-    if (!chain)
+    if (!chain || chain->registeredSlot == 0)
     {
         return;
     }
 
-    CguiRegisteredTransitionChain *current  = cguiRegisteredTransitionChains;
-    CguiRegisteredTransitionChain *previous = NULL;
+    CguiRemoveRegisteredChain(chain);
+}
 
-    while (current)
+CguiTransitionChain *CguiResolveTransitionHandle(CguiTransitionHandle handle)
+{
+    if (handle.generation == 0 || handle.index >= (unsigned int) cguiTransitionSlotsCount)
     {
-        if (current->chain == chain)
-        {
-            if (previous)
-            {
-                previous->next = current->next;
-            }
-            else
-            {
-                cguiRegisteredTransitionChains = current->next;
-            }
+        return NULL;
+    }
 
-            CG_FREE_NULL(current);
-            break;
-        }
+    CguiTransitionSlot *slot = &cguiTransitionSlots[handle.index];
+    return slot->generation == handle.generation ? cguiRegisteredTransitionChains[slot->registered].chain : NULL;
+}
 
-        previous = current;
-        current  = current->next;
+int CguiGetRegisteredTransitionsCount(void)
+{
+    return cguiRegisteredTransitionChainsCount;
+}
+
+void CguiClearRegisteredTransitions(void)
+{
+    // Also removes the chains from the registry
+    while (cguiRegisteredTransitionChainsCount > 0)
+    {
+        CguiDeleteTransitionChain(cguiRegisteredTransitionChains[cguiRegisteredTransitionChainsCount - 1].chain);
     }
 }
 
 void CguiUpdateRegisteredTransitions(void)
 {
-    CguiRegisteredTransitionChain *current = cguiRegisteredTransitionChains;
+    CguiBeginTransitionBatch();
 
-    while (current)
+    // Reverse order, so a removed chain is replaced by an already updated chain
+    for (int i = cguiRegisteredTransitionChainsCount - 1; i >= 0; i--)
     {
-        if (current->chain)
+        CguiTransitionChain *chain = cguiRegisteredTransitionChains[i].chain;
+
+        CguiUpdateTransitionChain(chain);
+        if (chain->finished)
         {
-            CguiUpdateTransitionChain(current->chain);
-            if (current->chain->finished)
-            {
-                CguiDeleteTransitionChain(current->chain);
-            }
+            // Also removes the chain from the registry
+            CguiDeleteTransitionChain(chain);
         }
-        current = current->next;
     }
+
+    CguiEndTransitionBatch();
 }
 
 void CguiInterpIntP(const int *a, const int *b, float t, int *out)
@@ -725,54 +1254,506 @@ void CguiInterpColorP(const Color *a, const Color *b, float t, Color *out)
     *out = CguiInterpColor(*a, *b, t);
 }
 
-void CguiInterpRectangleP(const Rectangle *a, const Rectangle *b, float t, Rectangle *out)
+// Fields of the common types, for the generated interpolators, equality functions and field tables
+
+#define CGUI_RECTANGLE_FIELDS(X) \
+    X(FLOAT, x)                  \
+    X(FLOAT, y)                  \
+    X(SIZE, width)               \
+    X(SIZE, height)
+
+#define CGUI_TRANSFORMATION_FIELDS(X) \
+    X(VECTOR2, position)              \
+    X(SIZE2, size)                    \
+    X(VECTOR2, isRelativePosition)    \
+    X(VECTOR2, isRelativeSize)        \
+    X(VECTOR2, anchor)                \
+    X(VECTOR2, shrink)
+
+#define CGUI_TEXT_ELEMENT_DATA_FIELDS(X) \
+    X(DISCRETE, text)                    \
+    X(FONT, font)                        \
+    X(FLOAT, fontSize)                   \
+    X(FLOAT, spacing)                    \
+    X(FLOAT, lineSpacing)                \
+    X(COLOR, color)                      \
+    X(DISCRETE, xJustify)                \
+    X(DISCRETE, yJustify)
+
+#define CGUI_TEXTURE_ELEMENT_DATA_FIELDS(X) \
+    X(TEXTURE, texture)                     \
+    X(RECTANGLE, source)                    \
+    X(VECTOR2, origin)                      \
+    X(FLOAT, rotation)                      \
+    X(COLOR, tint)
+
+#define CGUI_BOX_ELEMENT_DATA_FIELDS(X) \
+    X(VECTOR4, radii)                   \
+    X(COLOR, color)                     \
+    X(TEXTURE, texture)                 \
+    X(FLOAT, shadowDistance)            \
+    X(VECTOR2, shadowOffset)            \
+    X(FLOAT, shadowShrink)              \
+    X(COLOR, shadowColor)               \
+    X(TEXTURE, shadowTexture)           \
+    X(FLOAT, borderThickness)           \
+    X(COLOR, borderColor)               \
+    X(TEXTURE, borderTexture)
+
+CG_DEFINE_INTERP(Rectangle, CguiInterpRectangleP, CguiIsRectangleEqualP, CguiGetRectangleFields, CGUI_RECTANGLE_FIELDS)
+CG_DEFINE_INTERP(CguiTransformation, CguiInterpTransformationP, CguiIsTransformationEqualP, CguiGetTransformationFields, CGUI_TRANSFORMATION_FIELDS)
+CG_DEFINE_INTERP(CguiTextElementData, CguiInterpTextElementDataP, CguiIsTextElementDataEqualP, CguiGetTextElementDataFields, CGUI_TEXT_ELEMENT_DATA_FIELDS)
+CG_DEFINE_INTERP(CguiTextureElementData, CguiInterpTextureElementDataP, CguiIsTextureElementDataEqualP, CguiGetTextureElementDataFields, CGUI_TEXTURE_ELEMENT_DATA_FIELDS)
+CG_DEFINE_INTERP(CguiBoxElementData, CguiInterpBoxElementDataP, CguiIsBoxElementDataEqualP, CguiGetBoxElementDataFields, CGUI_BOX_ELEMENT_DATA_FIELDS)
+
+void CguiInterpFloatBatch(const float *a, const float *b, const float *t, float *out, int count)
 {
-    if (!a || !b || !out)
+    int i = 0;
+
+#ifdef CGUI_SIMD_AVX
+    for (; i + 8 <= count; i += 8)
     {
-        return;
+        __m256 va = _mm256_loadu_ps(&a[i]);
+        __m256 vb = _mm256_loadu_ps(&b[i]);
+        __m256 vt = _mm256_loadu_ps(&t[i]);
+
+        _mm256_storeu_ps(&out[i], _mm256_add_ps(va, _mm256_mul_ps(_mm256_sub_ps(vb, va), vt)));
+    }
+#endif
+
+#ifdef CGUI_SIMD_SSE
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 va = _mm_loadu_ps(&a[i]);
+        __m128 vb = _mm_loadu_ps(&b[i]);
+        __m128 vt = _mm_loadu_ps(&t[i]);
+
+        _mm_storeu_ps(&out[i], _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), vt)));
+    }
+#endif
+
+#ifdef CGUI_SIMD_NEON
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t va = vld1q_f32(&a[i]);
+        float32x4_t vb = vld1q_f32(&b[i]);
+        float32x4_t vt = vld1q_f32(&t[i]);
+
+        // Note: vfmaq is avoided, fused multiply-add rounds differently from the scalar tail
+        vst1q_f32(&out[i], vaddq_f32(va, vmulq_f32(vsubq_f32(vb, va), vt)));
     }
+#endif
 
-    *out = CguiInterpRectangle(*a, *b, t);
+    // Remaining (or all, without SIMD)
+    for (; i < count; i++)
+    {
+        out[i] = a[i] + (b[i] - a[i]) * t[i];
+    }
 }
 
-void CguiInterpTransformationP(const CguiTransformation *a, const CguiTransformation *b, float t, CguiTransformation *out)
+// Make room for the lanes of a transition, returns false on failure
+static bool CguiReserveInterpLanes(int count)
 {
-    if (!a || !b || !out)
+    if (cguiInterpLanesCount + count <= cguiInterpLanesCapacity)
     {
-        return;
+        return true;
+    }
+
+    int newCapacity = (cguiInterpLanesCapacity == 0) ? 256 : (cguiInterpLanesCapacity * 2);
+    while (newCapacity < cguiInterpLanesCount + count)
+    {
+        newCapacity *= 2;
+    }
+
+    // Each array is kept if grown, the capacity is only updated once all are grown
+    float *newFrom = CG_REALLOC(cguiInterpLanesFrom, sizeof(float) * newCapacity);
+    if (!newFrom)
+    {
+        return false;
+    }
+    cguiInterpLanesFrom = newFrom;
+
+    float *newTo = CG_REALLOC(cguiInterpLanesTo, sizeof(float) * newCapacity);
+    if (!newTo)
+    {
+        return false;
     }
+    cguiInterpLanesTo = newTo;
 
-    *out = CguiInterpTransformation(*a, *b, t);
+    float *newT = CG_REALLOC(cguiInterpLanesT, sizeof(float) * newCapacity);
+    if (!newT)
+    {
+        return false;
+    }
+    cguiInterpLanesT = newT;
+
+    void **newResult = CG_REALLOC(cguiInterpLanesResult, sizeof(void *) * newCapacity);
+    if (!newResult)
+    {
+        return false;
+    }
+    cguiInterpLanesResult = newResult;
+
+    unsigned char *newKind = CG_REALLOC(cguiInterpLanesKind, sizeof(unsigned char) * newCapacity);
+    if (!newKind)
+    {
+        return false;
+    }
+    cguiInterpLanesKind = newKind;
+
+    cguiInterpLanesCapacity = newCapacity;
+    return true;
 }
 
-void CguiInterpTextElementDataP(const CguiTextElementData *a, const CguiTextElementData *b, float t, CguiTextElementData *out)
+// Whole values of the interpolators for common types that are not generated, as single fields
+static const CguiInterpField cguiFloatField   = { 0, sizeof(float), CGUI_INTERP_FIELD_KIND_FLOAT };
+static const CguiInterpField cguiVector2Field = { 0, sizeof(Vector2), CGUI_INTERP_FIELD_KIND_VECTOR2 };
+static const CguiInterpField cguiVector3Field = { 0, sizeof(Vector3), CGUI_INTERP_FIELD_KIND_VECTOR3 };
+static const CguiInterpField cguiVector4Field = { 0, sizeof(Vector4), CGUI_INTERP_FIELD_KIND_VECTOR4 };
+static const CguiInterpField cguiColorField   = { 0, sizeof(Color), CGUI_INTERP_FIELD_KIND_COLOR };
+
+// Get the fields of the value of an interpolator, NULL if it cannot be split into lanes
+static const CguiInterpField *CguiGetInterpFields(CguiInterpFunction interp, CguiInterpFieldsFunction fieldsFunction, int *fieldsCount)
 {
-    if (!a || !b || !out)
+    // Field table given along with a generated interpolator
+    if (fieldsFunction)
     {
-        return;
+        return fieldsFunction(fieldsCount);
     }
 
-    *out = CguiInterpTextElementData(*a, *b, t);
+    *fieldsCount = 1;
+
+    if (interp == (CguiInterpFunction) CguiInterpFloatP) return &cguiFloatField;
+    if (interp == (CguiInterpFunction) CguiInterpVector2P) return &cguiVector2Field;
+    if (interp == (CguiInterpFunction) CguiInterpVector3P) return &cguiVector3Field;
+    if (interp == (CguiInterpFunction) CguiInterpVector4P) return &cguiVector4Field;
+    if (interp == (CguiInterpFunction) CguiInterpColorP) return &cguiColorField;
+    if (interp == (CguiInterpFunction) CguiInterpRectangleP) return CguiGetRectangleFields(fieldsCount);
+    if (interp == (CguiInterpFunction) CguiInterpTransformationP) return CguiGetTransformationFields(fieldsCount);
+    if (interp == (CguiInterpFunction) CguiInterpTextElementDataP) return CguiGetTextElementDataFields(fieldsCount);
+    if (interp == (CguiInterpFunction) CguiInterpTextureElementDataP) return CguiGetTextureElementDataFields(fieldsCount);
+    if (interp == (CguiInterpFunction) CguiInterpBoxElementDataP) return CguiGetBoxElementDataFields(fieldsCount);
+
+    return NULL;
 }
 
-void CguiInterpTextureElementDataP(const CguiTextureElementData *a, const CguiTextureElementData *b, float t, CguiTextureElementData *out)
+// Number of lanes of a field, 0 if discrete (-1 if not supported)
+static int CguiGetInterpFieldLanesCount(int kind)
 {
-    if (!a || !b || !out)
+    switch (kind)
+    {
+        case CGUI_INTERP_FIELD_KIND_FLOAT:
+        case CGUI_INTERP_FIELD_KIND_SIZE:
+            return 1;
+        case CGUI_INTERP_FIELD_KIND_VECTOR2:
+        case CGUI_INTERP_FIELD_KIND_SIZE2:
+            return 2;
+        case CGUI_INTERP_FIELD_KIND_VECTOR3:
+            return 3;
+        case CGUI_INTERP_FIELD_KIND_VECTOR4:
+        case CGUI_INTERP_FIELD_KIND_RECTANGLE:
+        case CGUI_INTERP_FIELD_KIND_COLOR:
+            return 4;
+        case CGUI_INTERP_FIELD_KIND_TEXTURE:
+        case CGUI_INTERP_FIELD_KIND_FONT:
+        case CGUI_INTERP_FIELD_KIND_DISCRETE:
+            return 0;
+        default:
+            // Note: int is not supported, converting both ends to float does not match `CguiInterpInt()`
+            return -1;
+    }
+}
+
+// Count the lanes of the fields, -1 if a field is not supported
+static int CguiCountInterpLanes(const CguiInterpField *fields, int fieldsCount)
+{
+    int lanesCount = 0;
+    for (int i = 0; i < fieldsCount; i++)
+    {
+        int count = CguiGetInterpFieldLanesCount(fields[i].kind);
+        if (count < 0)
+        {
+            return -1;
+        }
+
+        lanesCount += count;
+    }
+
+    return lanesCount;
+}
+
+// How a lane of a field is stored (see CguiInterpLaneKind)
+static unsigned char CguiGetInterpLaneKind(const CguiInterpField *field, int index)
+{
+    switch (field->kind)
+    {
+        case CGUI_INTERP_FIELD_KIND_SIZE:
+        case CGUI_INTERP_FIELD_KIND_SIZE2:
+            return CGUI_INTERP_LANE_SIZE;
+        case CGUI_INTERP_FIELD_KIND_RECTANGLE:
+            return index < 2 ? CGUI_INTERP_LANE_FLOAT : CGUI_INTERP_LANE_SIZE; // Position, then size
+        case CGUI_INTERP_FIELD_KIND_COLOR:
+            return CGUI_INTERP_LANE_BYTE;
+        default:
+            return CGUI_INTERP_LANE_FLOAT;
+    }
+}
+
+// Offset of a lane of a field in the value
+static int CguiGetInterpLaneOffset(const CguiInterpField *field, int index)
+{
+    if (field->kind == CGUI_INTERP_FIELD_KIND_COLOR)
+    {
+        return field->offset + index;
+    }
+
+    return field->offset + index * (int) sizeof(float);
+}
+
+// Read a lane of a value as float
+static float CguiReadInterpLane(const unsigned char *value, int offset, unsigned char kind)
+{
+    if (kind == CGUI_INTERP_LANE_BYTE)
+    {
+        return value[offset];
+    }
+
+    return *(const float *) (value + offset);
+}
+
+// Add the transition to the batch, returns false if the interpolator is not supported
+static bool CguiDeferInterp(CguiTransition *transition, float t)
+{
+    int                    fieldsCount = 0;
+    const CguiInterpField *fields      = CguiGetInterpFields(transition->interp, transition->fields, &fieldsCount);
+    int                    lanesCount  = fields ? CguiCountInterpLanes(fields, fieldsCount) : -1;
+    if (lanesCount < 0 || !CguiReserveInterpLanes(lanesCount))
+    {
+        return false;
+    }
+
+    const unsigned char *from     = transition->from;
+    const unsigned char *to       = transition->to;
+    unsigned char       *result   = transition->result;
+    float                tClamped = Clamp(t, 0.0f, 1.0f); // Do clamp t of bytes to prevent overflow
+
+    for (int i = 0; i < fieldsCount; i++)
+    {
+        const CguiInterpField *field = &fields[i];
+        int                    count = CguiGetInterpFieldLanesCount(field->kind);
+
+        // Discrete fields are stored right away
+        if (count == 0)
+        {
+            memmove(result + field->offset, (t <= 0.5f ? from : to) + field->offset, field->size);
+            continue;
+        }
+
+        for (int j = 0; j < count; j++)
+        {
+            unsigned char kind   = CguiGetInterpLaneKind(field, j);
+            int           offset = CguiGetInterpLaneOffset(field, j);
+            int           lane   = cguiInterpLanesCount++;
+
+            cguiInterpLanesFrom[lane]   = CguiReadInterpLane(from, offset, kind);
+            cguiInterpLanesTo[lane]     = CguiReadInterpLane(to, offset, kind);
+            cguiInterpLanesT[lane]      = kind == CGUI_INTERP_LANE_BYTE ? tClamped : t;
+            cguiInterpLanesResult[lane] = result + offset;
+            cguiInterpLanesKind[lane]   = kind;
+        }
+    }
+
+    return true;
+}
+
+void CguiBeginTransitionBatch(void)
+{
+    cguiTransitionBatchDepth++;
+}
+
+void CguiEndTransitionBatch(void)
+{
+    if (cguiTransitionBatchDepth == 0)
     {
         return;
     }
 
-    *out = CguiInterpTextureElementData(*a, *b, t);
+    // Nested batches end with the outermost batch
+    if (--cguiTransitionBatchDepth > 0)
+    {
+        return;
+    }
+
+    // Interpolated in place of the starting values
+    CguiInterpFloatBatch(cguiInterpLanesFrom, cguiInterpLanesTo, cguiInterpLanesT, cguiInterpLanesFrom, cguiInterpLanesCount);
+
+    // Stored in the order added, so the last transition to the same value wins
+    for (int i = 0; i < cguiInterpLanesCount; i++)
+    {
+        float value = cguiInterpLanesFrom[i];
+
+        switch (cguiInterpLanesKind[i])
+        {
+            case CGUI_INTERP_LANE_FLOAT:
+                *(float *) cguiInterpLanesResult[i] = value;
+                break;
+            case CGUI_INTERP_LANE_SIZE:
+                *(float *) cguiInterpLanesResult[i] = fmaxf(value, 0.0f); // Size should not be < 0.0f
+                break;
+            case CGUI_INTERP_LANE_BYTE:
+                *(unsigned char *) cguiInterpLanesResult[i] = (unsigned char) value;
+                break;
+        }
+    }
+
+    cguiInterpLanesCount = 0;
 }
 
-void CguiInterpBoxElementDataP(const CguiBoxElementData *a, const CguiBoxElementData *b, float t, CguiBoxElementData *out)
+// Store a lane of a value moved by a spring
+static void CguiWriteSpringLane(unsigned char *value, int offset, unsigned char kind, float lane)
 {
-    if (!a || !b || !out)
+    switch (kind)
+    {
+        case CGUI_INTERP_LANE_FLOAT:
+            *(float *) (value + offset) = lane;
+            break;
+        case CGUI_INTERP_LANE_SIZE:
+            *(float *) (value + offset) = fmaxf(lane, 0.0f); // Size should not be < 0.0f
+            break;
+        case CGUI_INTERP_LANE_BYTE:
+            value[offset] = (unsigned char) Clamp(lane, 0.0f, 255.0f); // Springs may overshoot
+            break;
+    }
+}
+
+CguiTransition *CguiCreateSpringTransition(const void *from, const void *to, void *result, CguiInterpFunction interp, float duration)
+{
+    return CguiSpringInterp(from, to, result, interp, NULL, duration);
+}
+
+CguiTransition *CguiSpringInterp(const void *a, const void *b, void *result, CguiInterpFunction interp, CguiInterpFieldsFunction fields, float duration)
+{
+    int                    fieldsCount = 0;
+    const CguiInterpField *fieldsTable = CguiGetInterpFields(interp, fields, &fieldsCount);
+    int                    lanesCount  = fieldsTable ? CguiCountInterpLanes(fieldsTable, fieldsCount) : -1;
+    if (lanesCount < 0)
+    {
+        CG_LOG_ERROR("Spring transitions do not support the interpolator");
+        return NULL;
+    }
+
+    CguiTransition *transition = CguiCreateTransitionEx(a, b, result, interp, NULL, duration);
+    if (!transition)
+    {
+        return NULL;
+    }
+
+    transition->fields = fields;
+
+    // Optimization: Allocated once, retargeting the spring does not allocate
+    transition->springState = CG_MALLOC_NULL(sizeof(float) * lanesCount * 2);
+    if (!transition->springState)
+    {
+        CguiDeleteTransition(transition);
+        return NULL;
+    }
+
+    transition->kind             = CGUI_TRANSITION_KIND_SPRING;
+    transition->springLanesCount = lanesCount;
+
+    CguiResetSpringTransition(transition);
+
+    return transition;
+}
+
+void CguiResetSpringTransition(CguiTransition *transition)
+{
+    if (!transition || transition->kind != CGUI_TRANSITION_KIND_SPRING || !transition->springState || !transition->from || !transition->result)
     {
         return;
     }
 
-    *out = CguiInterpBoxElementData(*a, *b, t);
+    int                    fieldsCount = 0;
+    const CguiInterpField *fields      = CguiGetInterpFields(transition->interp, transition->fields, &fieldsCount);
+    float                 *values      = transition->springState;
+    float                 *velocities  = transition->springState + transition->springLanesCount;
+
+    int lane = 0;
+    for (int i = 0; fields && i < fieldsCount; i++)
+    {
+        const CguiInterpField *field = &fields[i];
+        int                    count = CguiGetInterpFieldLanesCount(field->kind);
+
+        for (int j = 0; j < count; j++, lane++)
+        {
+            values[lane]     = CguiReadInterpLane(transition->from, CguiGetInterpLaneOffset(field, j), CguiGetInterpLaneKind(field, j));
+            velocities[lane] = 0.0f;
+        }
+    }
+
+    transition->interp(transition->from, transition->to, 0.0f, transition->result);
+}
+
+bool CguiStepSpringTransition(CguiTransition *transition, float deltaTime)
+{
+    if (!transition || transition->kind != CGUI_TRANSITION_KIND_SPRING || !transition->springState || !transition->to || !transition->result)
+    {
+        return true;
+    }
+
+    int                    fieldsCount = 0;
+    const CguiInterpField *fields      = CguiGetInterpFields(transition->interp, transition->fields, &fieldsCount);
+    const unsigned char   *to          = transition->to;
+    unsigned char         *result      = transition->result;
+    float                 *values      = transition->springState;
+    float                 *velocities  = transition->springState + transition->springLanesCount;
+
+    // Without a duration, the spring reaches the target right away
+    bool  instant = transition->duration <= 0.0f;
+    float omega   = instant ? 0.0f : CGUI_SPRING_SETTLE_FACTOR / transition->duration;
+    float decay   = expf(-omega * deltaTime);
+    bool  resting = true;
+
+    int lane = 0;
+    for (int i = 0; fields && i < fieldsCount; i++)
+    {
+        const CguiInterpField *field = &fields[i];
+        int                    count = CguiGetInterpFieldLanesCount(field->kind);
+
+        // Discrete fields take the target right away
+        if (count == 0)
+        {
+            memmove(result + field->offset, to + field->offset, field->size);
+            continue;
+        }
+
+        for (int j = 0; j < count; j++, lane++)
+        {
+            unsigned char kind   = CguiGetInterpLaneKind(field, j);
+            int           offset = CguiGetInterpLaneOffset(field, j);
+            float         target = CguiReadInterpLane(to, offset, kind);
+
+            // Critically damped spring, exact for the step while the target is held
+            float delta      = values[lane] - target;
+            float impulse    = (velocities[lane] + omega * delta) * deltaTime;
+            velocities[lane] = (velocities[lane] - omega * impulse) * decay;
+            values[lane]     = target + (delta + impulse) * decay;
+
+            if (instant || (fabsf(values[lane] - target) < CGUI_SPRING_REST_THRESHOLD && fabsf(velocities[lane]) < CGUI_SPRING_REST_THRESHOLD * omega))
+            {
+                values[lane]     = target;
+                velocities[lane] = 0.0f;
+            }
+            else
+            {
+                resting = false;
+            }
+
+            CguiWriteSpringLane(result, offset, kind, values[lane]);
+        }
+    }
+
+    return resting;
 }
 
 CguiTransition *CguiTransitInt(const int *a, const int *b, int *result, CguiEasingFunction easing, float duration)
@@ -829,3 +1810,64 @@ CguiTransition *CguiTransitBoxElementData(const CguiBoxElementData *a, const Cgu
 {
     return CguiCreateTransitionEx(a, b, result, (CguiInterpFunction) CguiInterpBoxElementDataP, easing, duration);
 }
+
+CguiTransition *CguiTransitInterp(const void *a, const void *b, void *result, CguiInterpFunction interp, CguiInterpFieldsFunction fields, CguiEasingFunction easing, float duration)
+{
+    CguiTransition *transition = CguiCreateTransitionEx(a, b, result, interp, easing, duration);
+    if (transition)
+    {
+        transition->fields = fields;
+    }
+
+    return transition;
+}
+
+CguiTransition *CguiSpringFloat(const float *a, const float *b, float *result, float duration)
+{
+    return CguiCreateSpringTransition(a, b, result, (CguiInterpFunction) CguiInterpFloatP, duration);
+}
+
+CguiTransition *CguiSpringVector2(const Vector2 *a, const Vector2 *b, Vector2 *result, float duration)
+{
+    return CguiCreateSpringTransition(a, b, result, (CguiInterpFunction) CguiInterpVector2P, duration);
+}
+
+CguiTransition *CguiSpringVector3(const Vector3 *a, const Vector3 *b, Vector3 *result, float duration)
+{
+    return CguiCreateSpringTransition(a, b, result, (CguiInterpFunction) CguiInterpVector3P, duration);
+}
+
+CguiTransition *CguiSpringVector4(const Vector4 *a, const Vector4 *b, Vector4 *result, float duration)
+{
+    return CguiCreateSpringTransition(a, b, result, (CguiInterpFunction) CguiInterpVector4P, duration);
+}
+
+CguiTransition *CguiSpringColor(const Color *a, const Color *b, Color *result, float duration)
+{
+    return CguiCreateSpringTransition(a, b, result, (CguiInterpFunction) CguiInterpColorP, duration);
+}
+
+CguiTransition *CguiSpringRectangle(const Rectangle *a, const Rectangle *b, Rectangle *result, float duration)
+{
+    return CguiCreateSpringTransition(a, b, result, (CguiInterpFunction) CguiInterpRectangleP, duration);
+}
+
+CguiTransition *CguiSpringTransformation(const CguiTransformation *a, const CguiTransformation *b, CguiTransformation *result, float duration)
+{
+    return CguiCreateSpringTransition(a, b, result, (CguiInterpFunction) CguiInterpTransformationP, duration);
+}
+
+CguiTransition *CguiSpringTextElementData(const CguiTextElementData *a, const CguiTextElementData *b, CguiTextElementData *result, float duration)
+{
+    return CguiCreateSpringTransition(a, b, result, (CguiInterpFunction) CguiInterpTextElementDataP, duration);
+}
+
+CguiTransition *CguiSpringTextureElementData(const CguiTextureElementData *a, const CguiTextureElementData *b, CguiTextureElementData *result, float duration)
+{
+    return CguiCreateSpringTransition(a, b, result, (CguiInterpFunction) CguiInterpTextureElementDataP, duration);
+}
+
+CguiTransition *CguiSpringBoxElementData(const CguiBoxElementData *a, const CguiBoxElementData *b, CguiBoxElementData *result, float duration)
+{
+    return CguiCreateSpringTransition(a, b, result, (CguiInterpFunction) CguiInterpBoxElementDataP, duration);
+}
@@ -0,0 +1,41 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This header file contains helpers shared by the tests.
+///
+/// This project is licensed under the terms of MIT license.
+
+#ifndef CG_TEST_H
+#define CG_TEST_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+// Directory of the test files (e.g., golden images)
+#ifndef CG_TEST_DIR
+#define CG_TEST_DIR "."
+#endif
+
+// Number of failed checks in the test
+static int cgTestFailures = 0;
+
+// Check a condition, report it and continue the test if it does not hold
+#define CG_CHECK(condition)                                                               \
+    do                                                                                    \
+    {                                                                                     \
+        if (!(condition))                                                                 \
+        {                                                                                 \
+            fprintf(stderr, "%s:%d: Check failed: %s\n", __FILE__, __LINE__, #condition); \
+            cgTestFailures++;                                                             \
+        }                                                                                 \
+    }                                                                                     \
+    while (false)
+
+// Exit code of the test
+#define CG_TEST_RESULT() (cgTestFailures == 0 ? 0 : 1)
+
+#endif // CG_TEST_H
@@ -0,0 +1,131 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This test file checks the lifetime of transition chains of cloned and copied components.
+///
+/// This project is licensed under the terms of MIT license.
+
+#include "cg_test.h"
+#include "crystalgui/crystalgui.h"
+#include "raylib.h"
+
+// Transition clock driven by the test
+static double testTime = 0.0;
+
+static double GetTestTime(void)
+{
+    return testTime;
+}
+
+static void AdvanceTestTime(float seconds)
+{
+    testTime += seconds;
+    CguiTickTransitionClock();
+}
+
+static CguiNode *CreateTestButton(void)
+{
+    return CguiCreateButton(CguiTAbsolute((Vector2) { 0, 0 }, (Vector2) { 10, 10 }), CGUI_BUTTON_TYPE_NORMAL, NULL, false);
+}
+
+// Start the transition of the button to its disabled style
+static void DisableTestButton(CguiNode *button)
+{
+    CguiButtonInstanceData *iData = button->instanceData;
+
+    iData->disabled = true;
+    CguiPreUpdateButton(button);
+}
+
+// Cloned component runs its own chain on its own values
+static void TestCloneOwnsChain(void)
+{
+    int pooled = CguiGetPooledTransitionsCount();
+
+    CguiNode *button = CreateTestButton();
+    DisableTestButton(button);
+    AdvanceTestTime(0.01f);
+    CguiUpdateScheduledTransitions();
+    CG_CHECK(CguiGetScheduledTransitionsCount() == 1);
+
+    CguiNode *clone = CguiCloneNode(button);
+    CG_CHECK(clone != NULL);
+    if (!clone)
+    {
+        CguiDeleteNode(button);
+        return;
+    }
+
+    CguiButtonInstanceData *iData      = button->instanceData;
+    CguiButtonInstanceData *cloneIData = clone->instanceData;
+    CG_CHECK(cloneIData->transitionChain && cloneIData->transitionChain != iData->transitionChain);
+    CG_CHECK(cloneIData->transitionChain->first->result == &cloneIData->transitioningBoxData);
+    CG_CHECK(cloneIData->transitionChain->activeTime == iData->transitionChain->activeTime);
+    CG_CHECK(CguiGetScheduledTransitionsCount() == 2);
+
+    // Clone keeps animating after the original is gone
+    CguiDeleteNode(button);
+    CG_CHECK(CguiGetScheduledTransitionsCount() == 1);
+
+    for (int i = 0; i < 100 && CguiGetScheduledTransitionsCount() > 0; i++)
+    {
+        AdvanceTestTime(0.1f);
+        CguiUpdateScheduledTransitions();
+    }
+
+    CguiButtonData *data = clone->data;
+    CG_CHECK(CguiGetScheduledTransitionsCount() == 0);
+    CG_CHECK(CguiIsBoxElementDataEqual(cloneIData->transitioningBoxData, data->disabledBoxDatas[CGUI_BUTTON_TYPE_NORMAL]));
+
+    CguiDeleteNode(clone);
+    CG_CHECK(CguiGetPooledTransitionsCount() == pooled);
+}
+
+// Component copied onto releases the chain it had
+static void TestCopyReleasesChain(void)
+{
+    int pooled = CguiGetPooledTransitionsCount();
+
+    CguiNode *from = CreateTestButton();
+    CguiNode *to   = CreateTestButton();
+    DisableTestButton(to);
+    CG_CHECK(CguiGetScheduledTransitionsCount() == 1);
+
+    CG_CHECK(CguiCopyNode(from, to));
+    CG_CHECK(CguiGetScheduledTransitionsCount() == 0);
+
+    CguiButtonInstanceData *fromIData = from->instanceData;
+    CguiButtonInstanceData *toIData   = to->instanceData;
+    CG_CHECK(toIData->transitionChain && toIData->transitionChain != fromIData->transitionChain);
+
+    // Copied chain runs once the copy changes its target
+    DisableTestButton(to);
+    CG_CHECK(CguiGetScheduledTransitionsCount() == 1);
+    AdvanceTestTime(0.1f);
+    CguiUpdateScheduledTransitions();
+
+    CguiDeleteNode(from);
+    CguiDeleteNode(to);
+    CG_CHECK(CguiGetScheduledTransitionsCount() == 0);
+    CG_CHECK(CguiGetPooledTransitionsCount() == pooled);
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    CguiInit();
+    CguiSetTransitionTimeFunction(GetTestTime);
+    CguiTickTransitionClock();
+
+    TestCloneOwnsChain();
+    TestCopyReleasesChain();
+
+    CguiClose();
+
+    return CG_TEST_RESULT();
+}
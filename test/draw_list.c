@@ -0,0 +1,178 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This test file checks the recorded commands of draw lists and their sorting.
+///
+/// This project is licensed under the terms of MIT license.
+
+#include "cg_test.h"
+#include "crystalgui/crystalgui.h"
+#include "raylib.h"
+
+static void DrawNothing(CguiNode *node)
+{
+    (void) node;
+}
+
+static void EmitTexture(unsigned int id, float x)
+{
+    CguiEmitTexture((Texture) { .id = id, .width = 1, .height = 1 }, (Rectangle) { 0, 0, 1, 1 }, (Rectangle) { x, 0, 10, 10 }, (Vector2) { 0, 0 }, 0.0f, WHITE);
+}
+
+// Emitted commands are recorded with the data of their type
+static void TestRecordedContent(void)
+{
+    CguiDrawList      *list = CguiCreateDrawList();
+    CguiNode          *node = CguiCreateNode();
+    CguiBoxElementData box  = { .radii = { 4, 4, 4, 4 }, .color = RED };
+
+    CguiBeginDrawList(list);
+    CguiEmitRectangle((Rectangle) { 1, 2, 3, 4 }, BLUE);
+    CguiEmitTexture((Texture) { .id = 7, .width = 8, .height = 8 }, (Rectangle) { 0, 0, 8, 8 }, (Rectangle) { 10, 10, 16, 16 }, (Vector2) { 8, 8 }, 90.0f, GREEN);
+    CguiEmitScissor((Rectangle) { 0, 0, 50, 50 });
+    CguiEmitBox((Rectangle) { 20, 20, 10, 10 }, box);
+    CguiEmitScissorEnd();
+    CguiEmitCallback(DrawNothing, node);
+    CguiEndDrawList();
+
+    CG_CHECK(list->commandsCount == 6);
+
+    CguiDrawCommand *commands = list->commands;
+    CG_CHECK(commands[0].type == CGUI_DRAW_COMMAND_TYPE_RECTANGLE);
+    CG_CHECK(commands[0].dest.x == 1 && commands[0].dest.height == 4);
+    CG_CHECK(ColorIsEqual(commands[0].data.rectangle.color, BLUE));
+
+    CG_CHECK(commands[1].type == CGUI_DRAW_COMMAND_TYPE_TEXTURE);
+    CG_CHECK(commands[1].data.texture.texture.id == 7);
+    CG_CHECK(commands[1].data.texture.origin.x == 8 && commands[1].data.texture.rotation == 90.0f);
+    CG_CHECK(ColorIsEqual(commands[1].data.texture.tint, GREEN));
+
+    CG_CHECK(commands[2].type == CGUI_DRAW_COMMAND_TYPE_SCISSOR_BEGIN);
+    CG_CHECK(commands[2].bounds.width == 50);
+
+    // Box bounds include the anti-aliased edge
+    CG_CHECK(commands[3].type == CGUI_DRAW_COMMAND_TYPE_BOX);
+    CG_CHECK(commands[3].dest.x == 20 && commands[3].dest.width == 10);
+    CG_CHECK(commands[3].bounds.x == 19 && commands[3].bounds.width == 12);
+    CG_CHECK(ColorIsEqual(commands[3].data.box.color, RED) && commands[3].data.box.radii.x == 4);
+
+    CG_CHECK(commands[4].type == CGUI_DRAW_COMMAND_TYPE_SCISSOR_END);
+
+    CG_CHECK(commands[5].type == CGUI_DRAW_COMMAND_TYPE_CALLBACK);
+    CG_CHECK(commands[5].data.callback.function == DrawNothing && commands[5].data.callback.node == node);
+
+    CguiDeleteNode(node);
+    CguiDeleteDrawList(list);
+}
+
+// Disjoint commands of the same texture are joined
+static void TestSortJoinsDisjoint(void)
+{
+    CguiDrawList *list = CguiCreateDrawList();
+
+    CguiBeginDrawList(list);
+    EmitTexture(1, 0);
+    EmitTexture(2, 20);
+    EmitTexture(1, 40);
+    EmitTexture(2, 60);
+    CguiEndDrawList();
+
+    CG_CHECK(CguiGetDrawListStateChanges(list) == 4);
+    CguiSortDrawList(list);
+    CG_CHECK(CguiGetDrawListStateChanges(list) == 2);
+
+    CG_CHECK(list->commandsCount == 4);
+    CG_CHECK(list->commands[0].dest.x == 0 && list->commands[1].dest.x == 40);
+    CG_CHECK(list->commands[2].dest.x == 20 && list->commands[3].dest.x == 60);
+
+    CguiDeleteDrawList(list);
+}
+
+// Commands do not move before overlapping commands, nor across barriers
+static void TestSortKeepsOrder(void)
+{
+    CguiDrawList *list = CguiCreateDrawList();
+
+    CguiBeginDrawList(list);
+    EmitTexture(1, 0);
+    EmitTexture(2, 5);
+    EmitTexture(1, 8);
+    CguiEmitScissor((Rectangle) { 0, 0, 100, 100 });
+    EmitTexture(2, 50);
+    CguiEmitScissorEnd();
+    CguiEndDrawList();
+
+    CguiSortDrawList(list);
+
+    CG_CHECK(list->commandsCount == 6);
+    CG_CHECK(list->commands[0].dest.x == 0 && list->commands[1].dest.x == 5 && list->commands[2].dest.x == 8);
+    CG_CHECK(list->commands[3].type == CGUI_DRAW_COMMAND_TYPE_SCISSOR_BEGIN);
+    CG_CHECK(list->commands[4].dest.x == 50);
+    CG_CHECK(list->commands[5].type == CGUI_DRAW_COMMAND_TYPE_SCISSOR_END);
+
+    CguiDeleteDrawList(list);
+}
+
+// Commands do not move before a box whose anti-aliased edge overlaps them
+static void TestSortKeepsBoxEdge(void)
+{
+    CguiDrawList *list = CguiCreateDrawList();
+
+    CguiBeginDrawList(list);
+    CguiEmitRectangle((Rectangle) { 0, 0, 5, 5 }, BLUE);
+    CguiEmitBox((Rectangle) { 10, 0, 10, 10 }, (CguiBoxElementData) { .color = RED });
+    CguiEmitRectangle((Rectangle) { 20.5f, 0, 5, 5 }, BLUE);
+    CguiEndDrawList();
+
+    CguiSortDrawList(list);
+
+    CG_CHECK(list->commands[0].type == CGUI_DRAW_COMMAND_TYPE_RECTANGLE);
+    CG_CHECK(list->commands[1].type == CGUI_DRAW_COMMAND_TYPE_BOX);
+    CG_CHECK(list->commands[2].type == CGUI_DRAW_COMMAND_TYPE_RECTANGLE);
+
+    CguiDeleteDrawList(list);
+}
+
+// Boxes are submitted one batch each, other commands are batched by texture
+static void TestBatchesCount(void)
+{
+    CguiDrawList *list = CguiCreateDrawList();
+
+    CguiBeginDrawList(list);
+    CguiEmitRectangle((Rectangle) { 0, 0, 5, 5 }, BLUE);
+    CguiEmitRectangle((Rectangle) { 10, 0, 5, 5 }, BLUE);
+    CguiEmitBox((Rectangle) { 0, 10, 10, 10 }, (CguiBoxElementData) { .color = RED });
+    CguiEmitBox((Rectangle) { 20, 10, 10, 10 }, (CguiBoxElementData) { .color = RED });
+    CguiEmitBox((Rectangle) { 40, 10, 10, 10 }, (CguiBoxElementData) { .color = RED });
+    EmitTexture(1, 0);
+    EmitTexture(1, 20);
+    CguiEmitScissor((Rectangle) { 0, 0, 50, 50 });
+    EmitTexture(1, 40);
+    EmitTexture(2, 60);
+    CguiEmitScissorEnd();
+    CguiEndDrawList();
+
+    CG_CHECK(CguiGetDrawListBatches(list) == 7);
+
+    CguiClearDrawList(list);
+    CG_CHECK(CguiGetDrawListBatches(list) == 0);
+
+    CguiDeleteDrawList(list);
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    TestRecordedContent();
+    TestSortJoinsDisjoint();
+    TestSortKeepsOrder();
+    TestSortKeepsBoxEdge();
+    TestBatchesCount();
+
+    return CG_TEST_RESULT();
+}
@@ -0,0 +1,161 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This test file checks the lifetime of nodes in the deletion queue.
+///
+/// This project is licensed under the terms of MIT license.
+
+#include "cg_test.h"
+#include "crystalgui/crystalgui.h"
+#include "raylib.h"
+
+// Number of deleteNodeData calls
+static int deletedCount = 0;
+
+static void CountDeleted(CguiNode *node)
+{
+    (void) node;
+    deletedCount++;
+}
+
+static CguiNode *CreateCountedNode(void)
+{
+    CguiNode *node       = CguiCreateNode();
+    node->deleteNodeData = CountDeleted;
+    return node;
+}
+
+// Queued child deleted along with its parent leaves the queue
+static void TestQueuedChildDeletedWithParent(void)
+{
+    CguiNode *parent = CreateCountedNode();
+    CguiNode *child  = CreateCountedNode();
+    CguiInsertChild(parent, child);
+
+    deletedCount = 0;
+    CG_CHECK(CguiQueueDeleteNode(child));
+    CguiDeleteNode(parent);
+
+    CG_CHECK(deletedCount == 2);
+    CG_CHECK(CguiFlushDeleteQueue(0) == 0);
+    CG_CHECK(deletedCount == 2);
+}
+
+// Queued node deleted by itself leaves the queue
+static void TestQueuedNodeDeletedSelf(void)
+{
+    CguiNode *node = CreateCountedNode();
+
+    deletedCount = 0;
+    CG_CHECK(CguiQueueDeleteNode(node));
+    CguiDeleteNodeSelf(node);
+
+    CG_CHECK(deletedCount == 1);
+    CG_CHECK(CguiFlushDeleteQueue(0) == 0);
+    CG_CHECK(deletedCount == 1);
+}
+
+// Queued instance stays disabled when synced with its template
+static void TestQueuedInstanceStaysDisabled(void)
+{
+    CguiNode *templateNode = CguiCreateNode();
+    CguiNode *root         = CguiCreateNode();
+    CguiNode *instance     = CguiCreateInstance(templateNode);
+    CguiInsertChild(root, instance);
+
+    CG_CHECK(CguiQueueDeleteNode(instance));
+    CG_CHECK(!instance->enabled);
+
+    CguiApplyTemplateResync(templateNode);
+    CguiSyncHierarchy(root);
+    CG_CHECK(!instance->enabled);
+
+    CG_CHECK(CguiFlushDeleteQueue(0) == 0);
+    CG_CHECK(root->childrenCount == 0);
+
+    CguiDeleteNode(root);
+    CguiDeleteNode(templateNode);
+}
+
+// Flush limit counts queued subtrees, queued descendants are deleted with them
+static void TestFlushLimit(void)
+{
+    CguiNode *root = CguiCreateNode();
+    CguiNode *a    = CreateCountedNode();
+    CguiNode *b    = CreateCountedNode();
+    CguiNode *c    = CreateCountedNode();
+    CguiNode *aa   = CreateCountedNode();
+    CguiInsertChildren(root, a, b, c, NULL);
+    CguiInsertChild(a, aa);
+
+    deletedCount = 0;
+    CguiQueueDeleteNode(aa);
+    CguiQueueDeleteNode(a);
+    CguiQueueDeleteNode(b);
+    CguiQueueDeleteNode(c);
+
+    // Queued child of a queued parent is not counted
+    CG_CHECK(CguiFlushDeleteQueue(2) == 1);
+    CG_CHECK(deletedCount == 3);
+    CG_CHECK(root->childrenCount == 1 && root->children[0] == c);
+
+    CG_CHECK(CguiFlushDeleteQueue(2) == 0);
+    CG_CHECK(deletedCount == 4);
+
+    CguiDeleteNode(root);
+}
+
+// Handle of a queued node resolves until the node is deleted
+static void TestQueuedNodeHandle(void)
+{
+    CguiNode      *node   = CguiCreateNode();
+    CguiNodeHandle handle = CguiGetNodeHandle(node);
+
+    CguiQueueDeleteNode(node);
+    CG_CHECK(CguiResolveHandle(handle) == node);
+
+    CguiFlushDeleteQueue(0);
+    CG_CHECK(CguiResolveHandle(handle) == NULL);
+}
+
+// Queued node is skipped by compiled passes before the queue is flushed
+static void TestQueuedSkippedByCompiledTree(void)
+{
+    CguiNode *root  = CguiCreateNodeEx(CguiTAbsolute((Vector2) { 0, 0 }, (Vector2) { 100, 100 }), "root");
+    CguiNode *below = CguiCreateNodeEx(CguiTAbsolute((Vector2) { 0, 0 }, (Vector2) { 50, 50 }), "below");
+    CguiNode *above = CguiCreateNodeEx(CguiTAbsolute((Vector2) { 0, 0 }, (Vector2) { 50, 50 }), "above");
+    CguiInsertChildren(root, below, above, NULL);
+
+    CguiCompiledTree *tree = CguiCreateCompiledTree(root);
+    CguiTransformCompiledTree(tree, true);
+    CG_CHECK(CguiCheckCompiledCollision(tree, (Vector2) { 10, 10 }) == above);
+
+    CG_CHECK(CguiQueueDeleteNode(above));
+    CG_CHECK(CguiCheckCompiledCollision(tree, (Vector2) { 10, 10 }) == below);
+    CG_CHECK(tree->nodesCount == 3 && !tree->nodes[2].enabled);
+
+    CguiFlushDeleteQueue(0);
+    CG_CHECK(CguiCheckCompiledCollision(tree, (Vector2) { 10, 10 }) == below);
+    CG_CHECK(tree->nodesCount == 2);
+
+    CguiDeleteCompiledTree(tree);
+    CguiDeleteNode(root);
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    TestQueuedChildDeletedWithParent();
+    TestQueuedNodeDeletedSelf();
+    TestQueuedInstanceStaysDisabled();
+    TestFlushLimit();
+    TestQueuedNodeHandle();
+    TestQueuedSkippedByCompiledTree();
+
+    return CG_TEST_RESULT();
+}
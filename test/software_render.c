@@ -0,0 +1,126 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This test file checks the software rendering of nodes against a golden image.
+///
+/// Run with CG_UPDATE_GOLDEN set in the environment to rewrite the golden image.
+///
+/// This project is licensed under the terms of MIT license.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "cg_test.h"
+#include "crystalgui/crystalgui.h"
+#include "raylib.h"
+
+#define GOLDEN_WIDTH     48
+#define GOLDEN_HEIGHT    32
+#define GOLDEN_FILE_NAME CG_TEST_DIR "/golden/software_render.rgba"
+
+// Font built on the CPU, every glyph is the same 3x5 block with a hole
+#define FONT_GLYPHS_COUNT 128
+#define FONT_TEXTURE_ID   100
+
+static GlyphInfo fontGlyphs[FONT_GLYPHS_COUNT];
+static Rectangle fontRecs[FONT_GLYPHS_COUNT];
+
+static Font CreateBlockFont(Image *atlas)
+{
+    *atlas = GenImageColor(4, 6, BLANK);
+    for (int y = 0; y < 5; y++)
+    {
+        for (int x = 0; x < 3; x++)
+        {
+            if (x != 1 || y != 2) ((Color *) atlas->data)[y * atlas->width + x] = WHITE;
+        }
+    }
+
+    for (int i = 0; i < FONT_GLYPHS_COUNT; i++)
+    {
+        fontGlyphs[i] = (GlyphInfo) { .value = i, .advanceX = 4 };
+        fontRecs[i]   = (Rectangle) { 0, 0, 3, 5 };
+    }
+
+    return (Font) {
+        .baseSize     = 5,
+        .glyphCount   = FONT_GLYPHS_COUNT,
+        .glyphPadding = 0,
+        .texture      = { .id = FONT_TEXTURE_ID, .width = atlas->width, .height = atlas->height, .mipmaps = 1, .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 },
+        .recs         = fontRecs,
+        .glyphs       = fontGlyphs,
+    };
+}
+
+// Boxes and texts of a node tree match the golden image without a window
+static void TestRenderNodeGolden(void)
+{
+    CguiInit();
+    CguiSetAppSize(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+
+    Image atlas;
+    Font  font = CreateBlockFont(&atlas);
+
+    CguiNode *root = CguiCreateNodeEx(CguiTAbsolute((Vector2) { 0, 0 }, (Vector2) { GOLDEN_WIDTH, GOLDEN_HEIGHT }), "root");
+    CguiNode *box  = CguiCreateBoxElementPro((Vector4) { 6, 6, 6, 6 }, (Color) { 40, 80, 200, 255 }, (Texture) { 0 }, 3.0f, (Vector2) { 1, 2 }, 0.0f, (Color) { 0, 0, 0, 128 }, (Texture) { 0 }, 2.0f, WHITE, (Texture) { 0 });
+    CguiNode *text = CguiCreateTextElementPro("Hi 42", font, 5.0f, 1.0f, 1.0f, (Color) { 255, 220, 0, 255 }, CGUI_TEXT_JUSTIFY_BEGIN, CGUI_TEXT_JUSTIFY_BEGIN);
+
+    box->transformation  = CguiTAbsolute((Vector2) { 4, 4 }, (Vector2) { 28, 18 });
+    text->transformation = CguiTAbsolute((Vector2) { 8, 24 }, (Vector2) { 36, 6 });
+    CguiInsertChild(root, box);
+    CguiInsertChild(root, text);
+    CguiTransformNode(root, true);
+
+    CguiSoftwareRenderer *renderer = CguiCreateSoftwareRenderer(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+    CG_CHECK(CguiSetSoftwareTexture(renderer, font.texture, atlas));
+    CguiClearSoftwareRenderer(renderer, (Color) { 30, 30, 30, 255 });
+    CguiRenderNodeSoftware(renderer, root);
+
+    int dataSize = GOLDEN_WIDTH * GOLDEN_HEIGHT * 4;
+    if (getenv("CG_UPDATE_GOLDEN"))
+    {
+        CG_CHECK(SaveFileData(GOLDEN_FILE_NAME, renderer->image.data, dataSize));
+    }
+
+    int            goldenSize = 0;
+    unsigned char *golden     = LoadFileData(GOLDEN_FILE_NAME, &goldenSize);
+    CG_CHECK(golden && goldenSize == dataSize);
+
+    if (golden && goldenSize == dataSize)
+    {
+        const Color *pixels       = renderer->image.data;
+        const Color *goldenPixels = (const Color *) golden;
+        int          mismatches   = 0;
+        for (int i = 0; i < GOLDEN_WIDTH * GOLDEN_HEIGHT; i++)
+        {
+            if (memcmp(&pixels[i], &goldenPixels[i], sizeof(Color)) != 0)
+            {
+                if (mismatches == 0) fprintf(stderr, "First mismatch at (%d, %d)\n", i % GOLDEN_WIDTH, i / GOLDEN_WIDTH);
+                mismatches++;
+            }
+        }
+
+        CG_CHECK(mismatches == 0);
+    }
+
+    UnloadFileData(golden);
+    CguiDeleteSoftwareRenderer(renderer);
+    CguiDeleteNode(root);
+    UnloadImage(atlas);
+
+    CguiSetAppSize(0, 0);
+    CguiClose();
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    TestRenderNodeGolden();
+
+    return CG_TEST_RESULT();
+}
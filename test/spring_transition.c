@@ -0,0 +1,291 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This test file checks the motion of spring transitions, the retargeting
+/// of components and the transitions of generated interpolators.
+///
+/// This project is licensed under the terms of MIT license.
+
+#include <math.h>
+
+#include "cg_test.h"
+#include "crystalgui/crystalgui.h"
+#include "raylib.h"
+
+#define STEP_TIME  (1.0f / 60.0f)
+#define STEPS_MAX  1000
+#define TOLERANCE  0.5f
+
+typedef struct TestData {
+    Vector2 offset;
+    Color   tint;
+    float   size;
+} TestData;
+
+#define TEST_DATA_FIELDS(X) X(VECTOR2, offset) X(COLOR, tint) X(SIZE, size)
+CG_DEFINE_INTERP(TestData, InterpTestDataP, IsTestDataEqualP, GetTestDataFields, TEST_DATA_FIELDS)
+
+// Changing the target keeps the value and the velocity of the spring
+static void TestRetargetContinuity(void)
+{
+    Vector2 from   = { 0, 0 };
+    Vector2 to     = { 100, 0 };
+    Vector2 result = { 0 };
+
+    CguiTransition *spring = CguiSpringVector2(&from, &to, &result, 0.5f);
+    CG_CHECK(spring != NULL);
+    if (!spring) return;
+
+    for (int i = 0; i < 5; i++)
+    {
+        CG_CHECK(!CguiStepSpringTransition(spring, STEP_TIME));
+    }
+
+    Vector2 before = result;
+    CG_CHECK(before.x > 0.0f && before.x < 100.0f);
+
+    // Value does not jump, and it keeps moving towards the old target for a moment
+    to = (Vector2) { -100, 0 };
+    CG_CHECK(!CguiStepSpringTransition(spring, 0.001f));
+    CG_CHECK(fabsf(result.x - before.x) < TOLERANCE);
+    CG_CHECK(result.x > before.x);
+
+    // Then it settles at the new target
+    bool resting = false;
+    for (int i = 0; i < STEPS_MAX && !resting; i++)
+    {
+        resting = CguiStepSpringTransition(spring, STEP_TIME);
+    }
+
+    CG_CHECK(resting);
+    CG_CHECK(result.x == -100.0f && result.y == 0.0f);
+
+    CguiDeleteTransition(spring);
+}
+
+// Spring is at rest exactly at the target once close enough and slow enough
+static void TestRestDetection(void)
+{
+    Color from   = { 0, 0, 0, 255 };
+    Color to     = { 200, 100, 50, 255 };
+    Color result = { 0 };
+
+    CguiTransition *spring = CguiSpringColor(&from, &to, &result, 0.25f);
+    CG_CHECK(spring != NULL);
+    if (!spring) return;
+
+    int  steps   = 0;
+    bool resting = false;
+    for (; steps < STEPS_MAX && !resting; steps++)
+    {
+        resting = CguiStepSpringTransition(spring, STEP_TIME);
+    }
+
+    // Comes to rest around the duration, not on the first step
+    CG_CHECK(resting);
+    CG_CHECK(steps > 1 && steps < STEPS_MAX / 10);
+    CG_CHECK(ColorIsEqual(result, to));
+
+    // Stays at rest, and moves again after a reset
+    CG_CHECK(CguiStepSpringTransition(spring, STEP_TIME));
+    CguiResetSpringTransition(spring);
+    CG_CHECK(ColorIsEqual(result, from));
+    CG_CHECK(!CguiStepSpringTransition(spring, STEP_TIME));
+
+    CguiDeleteTransition(spring);
+}
+
+// Spring without a duration reaches the target on the first step
+static void TestZeroDuration(void)
+{
+    float from   = 0.0f;
+    float to     = 10.0f;
+    float result = 0.0f;
+
+    CguiTransition *spring = CguiSpringFloat(&from, &to, &result, 0.0f);
+    CG_CHECK(spring != NULL);
+    if (!spring) return;
+
+    CG_CHECK(CguiStepSpringTransition(spring, STEP_TIME));
+    CG_CHECK(result == 10.0f);
+
+    to = 20.0f;
+    CG_CHECK(CguiStepSpringTransition(spring, 0.0f));
+    CG_CHECK(result == 20.0f);
+
+    CguiDeleteTransition(spring);
+}
+
+// Transitions without a spring state are left alone
+static void TestWithoutSpringState(void)
+{
+    float from   = 0.0f;
+    float to     = 10.0f;
+    float result = 5.0f;
+
+    CguiTransition *eased = CguiTransitFloat(&from, &to, &result, NULL, 1.0f);
+    CG_CHECK(eased != NULL);
+    if (!eased) return;
+
+    eased->kind = CGUI_TRANSITION_KIND_SPRING;
+    CG_CHECK(CguiStepSpringTransition(eased, STEP_TIME));
+    CguiResetSpringTransition(eased);
+    CG_CHECK(result == 5.0f);
+
+    CguiDeleteTransition(eased);
+}
+
+static double fixedStepTime = 0.0;
+
+static double GetFixedStepTime(void)
+{
+    return fixedStepTime;
+}
+
+// With a fixed step, updates advance springs one step at a time, up to the steps limit
+static void TestFixedStepUpdate(void)
+{
+    CguiNode *root = CguiCreateNode();
+    CG_CHECK(root != NULL);
+    if (!root) return;
+
+    float from     = 0.0f;
+    float to       = 100.0f;
+    float result   = 0.0f;
+    float expected = 0.0f;
+
+    CguiTransition *spring  = CguiSpringFloat(&from, &to, &result, 1.0f);
+    CguiTransition *stepped = CguiSpringFloat(&from, &to, &expected, 1.0f);
+    CG_CHECK(spring != NULL && stepped != NULL);
+    if (!spring || !stepped) return;
+
+    CguiRegisterAutoTransition(spring);
+    CguiSetTransitionTimeFunction(GetFixedStepTime);
+    CguiSetTransitionFixedStep(STEP_TIME);
+
+    CguiUpdate(root);
+    CG_CHECK(CguiGetTransitionStepsCount() == 0);
+
+    fixedStepTime = 3.5 * STEP_TIME;
+    CguiUpdate(root);
+    CG_CHECK(CguiGetTransitionStepsCount() == 3);
+
+    for (int i = 0; i < 3; i++)
+    {
+        CguiStepSpringTransition(stepped, STEP_TIME);
+    }
+
+    CG_CHECK(result == expected);
+
+    fixedStepTime = 100.0;
+    CguiUpdate(root);
+    CG_CHECK(CguiGetTransitionStepsCount() > 3 && CguiGetTransitionStepsCount() < 100);
+
+    CguiSetTransitionFixedStep(0.0f);
+    CguiSetTransitionTimeFunction(NULL);
+    CguiClearRegisteredTransitions();
+    CguiDeleteTransition(stepped);
+    CguiDeleteNode(root);
+}
+
+// Box data edited in place is noticed once its version changes, without a state change
+static void TestButtonInPlaceEdit(void)
+{
+    CguiNode *button = CguiCreateButton(CguiTAbsolute((Vector2) { 0, 0 }, (Vector2) { 10, 10 }), CGUI_BUTTON_TYPE_NORMAL, NULL, false);
+    CG_CHECK(button != NULL);
+    if (!button) return;
+
+    CguiButtonData         *data  = button->data;
+    CguiButtonInstanceData *iData = button->instanceData;
+
+    CguiPreUpdateButton(button);
+    CG_CHECK(CguiIsBoxElementDataEqual(iData->targetBoxData, data->boxDatas[CGUI_BUTTON_TYPE_NORMAL]));
+
+    data->boxDatas[CGUI_BUTTON_TYPE_NORMAL].color = (Color) { 1, 2, 3, 255 };
+    CguiPreUpdateButton(button);
+    CG_CHECK(!ColorIsEqual(iData->targetBoxData.color, (Color) { 1, 2, 3, 255 }));
+
+    data->version++;
+    CguiPreUpdateButton(button);
+    CG_CHECK(ColorIsEqual(iData->targetBoxData.color, (Color) { 1, 2, 3, 255 }));
+
+    CguiDeleteNode(button);
+}
+
+// Springs move user structs given their field table
+static void TestSpringUserInterp(void)
+{
+    TestData from   = { { 0, 0 }, { 0, 0, 0, 255 }, 10.0f };
+    TestData to     = { { 100, 50 }, { 200, 100, 50, 255 }, 20.0f };
+    TestData result = { 0 };
+
+    // Without the field table the value cannot be split into lanes
+    CG_CHECK(CguiCreateSpringTransition(&from, &to, &result, (CguiInterpFunction) InterpTestDataP, 0.25f) == NULL);
+
+    CguiTransition *spring = CguiSpringInterp(&from, &to, &result, (CguiInterpFunction) InterpTestDataP, GetTestDataFields, 0.25f);
+    CG_CHECK(spring != NULL);
+    if (!spring) return;
+
+    CG_CHECK(spring->springLanesCount == 7);
+    CG_CHECK(IsTestDataEqualP(&result, &from));
+
+    bool resting = false;
+    for (int i = 0; i < STEPS_MAX && !resting; i++)
+    {
+        resting = CguiStepSpringTransition(spring, STEP_TIME);
+    }
+
+    CG_CHECK(resting);
+    CG_CHECK(IsTestDataEqualP(&result, &to));
+
+    CguiDeleteTransition(spring);
+}
+
+// Eased transitions of user structs are deferred to the batch given their field table
+static void TestBatchUserInterp(void)
+{
+    TestData from     = { { 0, 0 }, { 0, 0, 0, 255 }, 10.0f };
+    TestData to       = { { 100, 50 }, { 200, 100, 50, 255 }, 20.0f };
+    TestData result   = { 0 };
+    TestData expected = { 0 };
+
+    CguiTransition *eased = CguiTransitInterp(&from, &to, &result, (CguiInterpFunction) InterpTestDataP, GetTestDataFields, NULL, 1.0f);
+    CG_CHECK(eased != NULL);
+    if (!eased) return;
+
+    CguiBeginTransitionBatch();
+    CguiUpdateTransition(eased, 0.25f);
+    CG_CHECK(IsTestDataEqualP(&result, &(TestData) { 0 }));
+    CguiEndTransitionBatch();
+
+    InterpTestDataP(&from, &to, 0.25f, &expected);
+    CG_CHECK(fabsf(result.offset.x - expected.offset.x) < 0.001f && fabsf(result.offset.y - expected.offset.y) < 0.001f);
+    CG_CHECK(ColorIsEqual(result.tint, expected.tint));
+    CG_CHECK(fabsf(result.size - expected.size) < 0.001f);
+
+    CguiDeleteTransition(eased);
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    CguiInit();
+
+    TestRetargetContinuity();
+    TestRestDetection();
+    TestZeroDuration();
+    TestWithoutSpringState();
+    TestFixedStepUpdate();
+    TestButtonInPlaceEdit();
+    TestSpringUserInterp();
+    TestBatchUserInterp();
+
+    CguiClose();
+
+    return CG_TEST_RESULT();
+}
@@ -0,0 +1,243 @@
+/// @file
+///
+/// @author    Anstro Pleuton
+/// @copyright Copyright (c) 2025 Anstro Pleuton
+///
+/// Crystal GUI - A GUI framework for raylib.
+///
+/// This test file checks the keys of timelines, their binary format round trip
+/// and the rejection of malformed data.
+///
+/// This project is licensed under the terms of MIT license.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cg_test.h"
+#include "crystalgui/crystalgui.h"
+#include "raylib.h"
+
+#define TIMELINE_FILE_NAME "timeline_test.cgtl"
+#define DATA_WORDS_MAX     64
+
+// Header words of the binary format
+#define HEADER_TRACKS_COUNT 2
+#define HEADER_KEYS_COUNT   3
+#define HEADER_DURATION     5
+#define HEADER_WORDS        6
+
+// Timeline of a 2 component track of 3 keys and a 1 component track of 2 keys
+static CguiTimeline *CreateTestTimeline(void)
+{
+    int           keysCounts[]       = { 3, 2 };
+    int           componentsCounts[] = { 2, 1 };
+    CguiTimeline *timeline           = CguiCreateTimeline(2, keysCounts, componentsCounts);
+    if (!timeline) return NULL;
+
+    CG_CHECK(CguiSetTimelineKey(timeline, 0, 0, 0.0f, (float[]) { 0, 10 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiSetTimelineKey(timeline, 0, 1, 1.0f, (float[]) { 4, 20 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiSetTimelineKey(timeline, 0, 2, 2.0f, (float[]) { 8, 30 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiSetTimelineKey(timeline, 1, 0, 0.5f, (float[]) { 1 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiSetTimelineKey(timeline, 1, 1, 1.5f, (float[]) { 3 }, CGUI_EASING_LINEAR));
+
+    return timeline;
+}
+
+static void CheckTestTimeline(const CguiTimeline *timeline)
+{
+    float out[2] = { 0 };
+
+    CG_CHECK(timeline->tracksCount == 2);
+    CG_CHECK(CguiGetTimelineTrackComponents(timeline, 0) == 2);
+    CG_CHECK(CguiGetTimelineDuration(timeline) == 2.0f);
+
+    CG_CHECK(CguiEvalTimelineTrack(timeline, 0, 0.5f, out));
+    CG_CHECK(out[0] == 2.0f && out[1] == 15.0f);
+    CG_CHECK(CguiEvalTimelineTrack(timeline, 0, 5.0f, out));
+    CG_CHECK(out[0] == 8.0f && out[1] == 30.0f);
+    CG_CHECK(CguiEvalTimelineTrack(timeline, 1, 1.0f, out));
+    CG_CHECK(out[0] == 2.0f);
+}
+
+// Keys are set in order with the set keys around them, and the duration follows the last keys
+static void TestSetKeyOrder(void)
+{
+    int           keysCounts[]       = { 3, 1 };
+    int           componentsCounts[] = { 1, 1 };
+    CguiTimeline *timeline           = CguiCreateTimeline(2, keysCounts, componentsCounts);
+    CG_CHECK(timeline != NULL);
+    if (!timeline) return;
+
+    // Keys can be set in any order while the keys around are unset
+    CG_CHECK(CguiSetTimelineKey(timeline, 0, 2, 3.0f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiSetTimelineKey(timeline, 0, 0, 1.0f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiGetTimelineDuration(timeline) == 3.0f);
+
+    CG_CHECK(!CguiSetTimelineKey(timeline, 0, 1, 0.5f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(!CguiSetTimelineKey(timeline, 0, 1, 3.5f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(!CguiSetTimelineKey(timeline, 0, 0, 4.0f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(!CguiSetTimelineKey(timeline, 0, 1, NAN, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(!CguiSetTimelineKey(timeline, 0, 1, INFINITY, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiSetTimelineKey(timeline, 0, 1, 2.0f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+
+    // Moving the last key earlier shortens the timeline to the last key of another track
+    CG_CHECK(CguiSetTimelineKey(timeline, 1, 0, 2.5f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiSetTimelineKey(timeline, 0, 2, 2.0f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiGetTimelineDuration(timeline) == 2.5f);
+
+    CguiUnloadTimeline(timeline);
+}
+
+// Duration follows the last set key of a track, and timelines with unset keys are not exported
+static void TestUnsetKeys(void)
+{
+    int           keysCounts[]       = { 3 };
+    int           componentsCounts[] = { 1 };
+    CguiTimeline *timeline           = CguiCreateTimeline(1, keysCounts, componentsCounts);
+    CG_CHECK(timeline != NULL);
+    if (!timeline) return;
+
+    CG_CHECK(CguiSetTimelineKey(timeline, 0, 0, 1.0f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiSetTimelineKey(timeline, 0, 1, 2.0f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiGetTimelineDuration(timeline) == 2.0f);
+
+    CG_CHECK(!CguiExportTimeline(timeline, TIMELINE_FILE_NAME));
+    CG_CHECK(!FileExists(TIMELINE_FILE_NAME));
+    CG_CHECK(CguiLoadTimelineFromMemory(timeline->data, timeline->dataSize) == NULL);
+
+    CG_CHECK(CguiSetTimelineKey(timeline, 0, 2, 2.5f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+    CG_CHECK(CguiGetTimelineDuration(timeline) == 2.5f);
+
+    CguiTimeline *loaded = CguiLoadTimelineFromMemory(timeline->data, timeline->dataSize);
+    CG_CHECK(loaded != NULL);
+    CguiUnloadTimeline(loaded);
+
+    CguiUnloadTimeline(timeline);
+}
+
+// Counts whose data does not fit in an int size are rejected
+static void TestCreateLimits(void)
+{
+    int keysCounts[]       = { INT32_MAX / 2, INT32_MAX / 2 };
+    int componentsCounts[] = { 16, 16 };
+
+    CG_CHECK(CguiCreateTimeline(2, keysCounts, componentsCounts) == NULL);
+    CG_CHECK(CguiCreateTimeline(1, (int[]) { INT32_MAX / 8 }, (int[]) { 1 }) == NULL);
+    CG_CHECK(CguiCreateTimeline(1, (int[]) { 1 }, (int[]) { 17 }) == NULL);
+    CG_CHECK(CguiCreateTimeline(1, (int[]) { -1 }, (int[]) { 1 }) == NULL);
+}
+
+// Exported timelines load from files and memory with the same keys
+static void TestRoundTrip(void)
+{
+    CguiTimeline *timeline = CreateTestTimeline();
+    CG_CHECK(timeline != NULL);
+    if (!timeline) return;
+
+    CheckTestTimeline(timeline);
+    CG_CHECK(CguiExportTimeline(timeline, TIMELINE_FILE_NAME));
+
+    CguiTimeline *loaded = CguiLoadTimeline(TIMELINE_FILE_NAME);
+    CG_CHECK(loaded != NULL);
+    if (loaded)
+    {
+        CG_CHECK(loaded->dataSize == timeline->dataSize);
+        CG_CHECK(memcmp(loaded->data, timeline->data, timeline->dataSize) == 0);
+        CheckTestTimeline(loaded);
+        CguiUnloadTimeline(loaded);
+    }
+
+    remove(TIMELINE_FILE_NAME);
+
+    // Loaded from memory references the data, and cannot be modified
+    uint32_t data[DATA_WORDS_MAX];
+    CG_CHECK(timeline->dataSize <= (int) sizeof(data));
+    memcpy(data, timeline->data, timeline->dataSize);
+
+    CguiTimeline *referenced = CguiLoadTimelineFromMemory(data, timeline->dataSize);
+    CG_CHECK(referenced != NULL);
+    if (referenced)
+    {
+        CG_CHECK(referenced->data == data);
+        CheckTestTimeline(referenced);
+        CG_CHECK(!CguiSetTimelineKey(referenced, 1, 1, 1.75f, (float[]) { 0 }, CGUI_EASING_LINEAR));
+        CguiUnloadTimeline(referenced);
+    }
+
+    CguiUnloadTimeline(timeline);
+}
+
+// Load a copy of the data with one word changed
+static CguiTimeline *LoadChangedData(const CguiTimeline *timeline, int word, uint32_t value)
+{
+    uint32_t data[DATA_WORDS_MAX];
+    memcpy(data, timeline->data, timeline->dataSize);
+    data[word] = value;
+
+    return CguiLoadTimelineFromMemory(data, timeline->dataSize);
+}
+
+// Malformed data is rejected without reading out of bounds
+static void TestRejectMalformed(void)
+{
+    CguiTimeline *timeline = CreateTestTimeline();
+    CG_CHECK(timeline != NULL);
+    if (!timeline) return;
+
+    uint32_t data[DATA_WORDS_MAX];
+    memcpy(data, timeline->data, timeline->dataSize);
+
+    // Truncated and misaligned
+    CG_CHECK(CguiLoadTimelineFromMemory(data, timeline->dataSize - 4) == NULL);
+    CG_CHECK(CguiLoadTimelineFromMemory(data, 8) == NULL);
+    CG_CHECK(CguiLoadTimelineFromMemory((unsigned char *) data + 2, timeline->dataSize) == NULL);
+
+    // Magic and version
+    CG_CHECK(LoadChangedData(timeline, 0, 0x4347544Cu) == NULL); // "LTGC"
+    CG_CHECK(LoadChangedData(timeline, 1, 0x01000000u) == NULL); // Version of the other byte order
+
+    // Counts larger than the data, and overflowing counts
+    CG_CHECK(LoadChangedData(timeline, HEADER_TRACKS_COUNT, 3) == NULL);
+    CG_CHECK(LoadChangedData(timeline, HEADER_KEYS_COUNT, UINT32_MAX) == NULL);
+    CG_CHECK(LoadChangedData(timeline, HEADER_TRACKS_COUNT, UINT32_MAX / 16 + 1) == NULL);
+
+    // Tracks out of bounds (first key, keys count, components, first value of the second track)
+    CG_CHECK(LoadChangedData(timeline, HEADER_WORDS + 4, 4) == NULL);
+    CG_CHECK(LoadChangedData(timeline, HEADER_WORDS + 5, 3) == NULL);
+    CG_CHECK(LoadChangedData(timeline, HEADER_WORDS + 6, 0) == NULL);
+    CG_CHECK(LoadChangedData(timeline, HEADER_WORDS + 7, 7) == NULL);
+
+    // Key times unset, not finite or out of order, and a duration not matching the keys
+    uint32_t nanTime      = 0x7FC00000u;
+    uint32_t infinityTime = 0x7F800000u;
+    uint32_t earlyTime    = 0x3F000000u; // 0.5f
+    uint32_t lateTime     = 0x40400000u; // 3.0f
+    int      timesWord    = HEADER_WORDS + 4 * 2;
+    CG_CHECK(LoadChangedData(timeline, timesWord + 1, nanTime) == NULL);
+    CG_CHECK(LoadChangedData(timeline, timesWord + 1, infinityTime) == NULL);
+    CG_CHECK(LoadChangedData(timeline, timesWord + 2, earlyTime) == NULL);
+    CG_CHECK(LoadChangedData(timeline, timesWord + 2, lateTime) == NULL);
+    CG_CHECK(LoadChangedData(timeline, HEADER_DURATION, lateTime) == NULL);
+
+    // Unchanged data still loads
+    CguiTimeline *loaded = CguiLoadTimelineFromMemory(data, timeline->dataSize);
+    CG_CHECK(loaded != NULL);
+    CguiUnloadTimeline(loaded);
+
+    CguiUnloadTimeline(timeline);
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    TestSetKeyOrder();
+    TestUnsetKeys();
+    TestCreateLimits();
+    TestRoundTrip();
+    TestRejectMalformed();
+
+    return CG_TEST_RESULT();
+}